@@ -9,6 +9,8 @@
 #include "analog_input.h"
 #include "encoder.h"
 #include "stepper_motor.h"
+#include "external_control.h"
+#include "instrumentation.h"
 
 #define F_CPU 32000000
 #include <util/delay.h>
@@ -91,15 +93,11 @@ void core_callback_initialize_hardware(void)
 	/* Initialize encoder */
 	init_quadrature_encoder();
 	
-	/* Initialize serial with 100 KHz */
-	uint16_t BSEL = 19;
-	int8_t BSCALE = 0;
-		
-	USARTD0_CTRLC = USART_CMODE_ASYNCHRONOUS_gc | USART_PMODE_DISABLED_gc | USART_CHSIZE_8BIT_gc;
-	USARTD0_BAUDCTRLA = *((uint8_t*)&BSEL);
-	USARTD0_BAUDCTRLB = (*(1+(uint8_t*)&BSEL) & 0x0F) | ((BSCALE<<4) & 0xF0);
-	USARTD0_CTRLB = USART_RXEN_bm;
-	USARTD0_CTRLA |= (INT_LEVEL_LOW << 4);
+	/* Initialize the timer of the interrupt statistics, after the ADC offset */
+	init_isr_instrumentation();
+	
+	/* Initialize external motor control with 100 KHz */
+	init_external_control();
 }
 
 void core_callback_reset_registers(void)
@@ -111,16 +109,82 @@ void core_callback_reset_registers(void)
 	app_regs.REG_INITIAL_PULSE_INTERVAL = 2000;
 	app_regs.REG_PULSE_STEP_INTERVAL = 10;
 	app_regs.REG_PULSE_PERIOD = 50;
+	app_regs.REG_PROFILE_TYPE = GM_PROFILE_LINEAR;
+	app_regs.REG_ACCELERATION = 40000;
+	app_regs.REG_JERK = 2000000;
+	
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		app_regs.REG_SEGMENTS[i] = 0;
+	}
+	
+	app_regs.REG_SEGMENT_QUEUE_SPACE = SEGMENT_QUEUE_SIZE;
+	app_regs.REG_POSITION = get_motor_position();
+	app_regs.REG_MOVE_TO = 0;
+	app_regs.REG_VELOCITY = 0;
+	app_regs.REG_CLOSED_LOOP = 0;
+	app_regs.REG_STEPS_PER_COUNT = 256;
+	app_regs.REG_CLOSED_LOOP_GAINS[0] = 128;
+	app_regs.REG_CLOSED_LOOP_GAINS[1] = 0;
+	app_regs.REG_POSITION_ERROR = 0;
+	app_regs.REG_WAVEFORM_LENGTH = 0;
+	
+	for (uint8_t i = 0; i < 32; i++)
+	{
+		app_regs.REG_WAVEFORM_SAMPLES[i] = 0;
+	}
+	
+	app_regs.REG_WAVEFORM_SAMPLE_INTERVAL = 1000;
+	app_regs.REG_WAVEFORM_CONTROL = 0;
+	app_regs.REG_OSCILLATION_AMPLITUDE = 1000;
+	app_regs.REG_OSCILLATION_FREQUENCY = 1000;
+	app_regs.REG_OSCILLATION_PHASE = 0;
+	app_regs.REG_OSCILLATION_CYCLES = 1;
+	app_regs.REG_STEP_GENERATOR = GM_GENERATOR_PERIOD;
+	app_regs.REG_HARDWARE_CRUISE = 0;
+	app_regs.REG_TRACE_CONTROL = 0;
+	app_regs.REG_TRACE_INDEX = 0;
+	app_regs.REG_SCHEDULED_START[0] = 0;
+	app_regs.REG_SCHEDULED_START[1] = 0;
+	
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		app_regs.REG_MOTION_COMMAND[i] = 0;
+	}
+	
+	app_regs.REG_EXTERNAL_CONTROL = GM_EXTERNAL_LEGACY;
+	app_regs.REG_EXTERNAL_BAUD_RATE = 100000;
+	app_regs.REG_ENCODER_VELOCITY = 0;
 }
 
 void core_callback_registers_were_reinitialized(void)
 {
+	/* Intervals saved before they had to fit the same TCC0 prescaler */
+	if (check_ramp_intervals(app_regs.REG_NOMINAL_PULSE_INTERVAL, app_regs.REG_INITIAL_PULSE_INTERVAL) == false)
+	{
+		app_regs.REG_NOMINAL_PULSE_INTERVAL = 250;
+		app_regs.REG_INITIAL_PULSE_INTERVAL = 2000;
+	}
+	
 	/* Write register that have effect on other zones of the code */
 	app_write_REG_CONTROL(&app_regs.REG_CONTROL);
 	app_write_REG_NOMINAL_PULSE_INTERVAL(&app_regs.REG_NOMINAL_PULSE_INTERVAL);
 	app_write_REG_INITIAL_PULSE_INTERVAL(&app_regs.REG_INITIAL_PULSE_INTERVAL);
 	app_write_REG_PULSE_STEP_INTERVAL(&app_regs.REG_PULSE_STEP_INTERVAL);
 	app_write_REG_PULSE_PERIOD(&app_regs.REG_PULSE_PERIOD);
+	app_write_REG_PROFILE_TYPE(&app_regs.REG_PROFILE_TYPE);
+	app_write_REG_ACCELERATION(&app_regs.REG_ACCELERATION);
+	app_write_REG_JERK(&app_regs.REG_JERK);
+	app_write_REG_CLOSED_LOOP(&app_regs.REG_CLOSED_LOOP);
+	app_write_REG_STEPS_PER_COUNT(&app_regs.REG_STEPS_PER_COUNT);
+	app_write_REG_CLOSED_LOOP_GAINS(app_regs.REG_CLOSED_LOOP_GAINS);
+	app_write_REG_WAVEFORM_LENGTH(&app_regs.REG_WAVEFORM_LENGTH);
+	app_write_REG_WAVEFORM_SAMPLE_INTERVAL(&app_regs.REG_WAVEFORM_SAMPLE_INTERVAL);
+	app_write_REG_STEP_GENERATOR(&app_regs.REG_STEP_GENERATOR);
+	app_write_REG_HARDWARE_CRUISE(&app_regs.REG_HARDWARE_CRUISE);
+	app_write_REG_TRACE_CONTROL(&app_regs.REG_TRACE_CONTROL);
+	app_write_REG_EXTERNAL_BAUD_RATE(&app_regs.REG_EXTERNAL_BAUD_RATE);
+	app_write_REG_EXTERNAL_CONTROL(&app_regs.REG_EXTERNAL_CONTROL);
 	
 	/* Read external states */
 	app_read_REG_STOP_SWITCH();
@@ -158,9 +222,14 @@ void core_callback_device_to_speed(void) {}
 /* Callbacks: 1 ms timer                                                */
 /************************************************************************/
 int16_t quadrature_previous_value = 0;
+int32_t encoder_velocity_previous_value = 0;
 
 extern bool send_motor_stopped_notification;
 
+int32_t position_current_value;
+uint32_t scheduled_start_second;
+uint16_t scheduled_start_tick;
+
 void core_callback_t_before_exec(void)
 {
 	/* Read ADC */
@@ -183,6 +252,19 @@ void core_callback_t_before_exec(void)
 		
 	quadrature_previous_value = app_regs.REG_ENCODER;
 	
+	/* Estimate the encoder velocity */
+	app_regs.REG_ENCODER_VELOCITY = update_encoder_velocity(get_harp_ticks());
+	
+	if (app_regs.REG_ENCODER_VELOCITY != encoder_velocity_previous_value)
+	{
+		if (app_regs.REG_CONTROL & B_ENABLE_QUAD_ENCODER)
+		{
+			core_func_send_event(ADD_REG_ENCODER_VELOCITY, true);
+		}
+	}
+	
+	encoder_velocity_previous_value = app_regs.REG_ENCODER_VELOCITY;
+	
 	/* Notify that motor is stopped */
 	if (send_motor_stopped_notification)
 	{		
@@ -191,6 +273,48 @@ void core_callback_t_before_exec(void)
 		app_regs.REG_MOVING = 0;
 		core_func_send_event(ADD_REG_MOVING, true);
 	}
+	
+	/* Notify the scheduled start with the time it happened */
+	if (get_scheduled_start_fired(&scheduled_start_second, &scheduled_start_tick))
+	{
+		app_regs.REG_MOVING = B_IS_MOVING;
+		core_func_update_user_timestamp(scheduled_start_second, scheduled_start_tick);
+		core_func_send_event(ADD_REG_MOVING, false);
+	}
+	
+	/* Notify changes on the free space of the segments queue */
+	if (app_regs.REG_SEGMENT_QUEUE_SPACE != get_segment_queue_space())
+	{
+		app_regs.REG_SEGMENT_QUEUE_SPACE = get_segment_queue_space();
+		core_func_send_event(ADD_REG_SEGMENT_QUEUE_SPACE, true);
+	}
+	
+	/* Notify changes on the motor position */
+	/* The position is read again if a step ISR changed it meanwhile */
+	position_current_value = get_motor_position();
+	
+	if (app_regs.REG_POSITION != position_current_value)
+	{
+		app_regs.REG_POSITION = position_current_value;
+		core_func_send_event(ADD_REG_POSITION, true);
+	}
+	
+	/* Notify the end of the waveform playback */
+	if (get_waveform_done())
+	{
+		app_regs.REG_WAVEFORM_CONTROL = B_STOP_WAVEFORM;
+		core_func_send_event(ADD_REG_WAVEFORM_CONTROL, true);
+	}
+	
+	/* Notify changes on the closed loop error */
+	if (app_regs.REG_CLOSED_LOOP & B_ENABLE_CLOSED_LOOP)
+	{
+		if (app_regs.REG_POSITION_ERROR != get_position_error())
+		{
+			app_regs.REG_POSITION_ERROR = get_position_error();
+			core_func_send_event(ADD_REG_POSITION_ERROR, true);
+		}
+	}
 }
 void core_callback_t_after_exec(void) {}
 void core_callback_t_new_second(void) {}
@@ -210,34 +334,37 @@ void core_callback_t_500us(void)
 	}
 }
 
-int32_t user_requested_steps = 0;
+extern bool motor_is_running;
 
 void core_callback_t_1ms(void)
 {
 	if ((app_regs.REG_CONTROL & B_ENABLE_MOTOR) == false)
 	{
-		/* Disable medium and high level interrupts */
-		/* Medium are enough but we can win some precious cpu time here */
-		PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
-		
 		/* Stop motor */
+		/* The step interrupts are turned off before anything else */
 		stop_rotation();
 		
-		/* Re-enable all interrupt levels */
-		PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+		/* The motor is free, so the closed loop starts again from the current position */
+		reset_closed_loop(get_quadrature_encoder());
 	}
 	
-	if (user_requested_steps != 0)
-	{	
-		/* Disable medium and high level interrupts */
-		/* Medium are enough but we can win some precious cpu time here */
-		PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
-		
-		/* Update steps with the user request */
-		user_requested_steps = user_sent_request(user_requested_steps);
-		
-		/* Re-enable all interrupt levels */
-		PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+	if ((app_regs.REG_CONTROL & B_ENABLE_MOTOR) && (app_regs.REG_CLOSED_LOOP & B_ENABLE_CLOSED_LOOP))
+	{
+		/* Post the steps missed according to the encoder, the step ISR takes them at the next pulse */
+		user_sent_request(update_closed_loop(get_quadrature_encoder()));
+	}
+	
+	if (!motor_is_running && !get_ramp_building() && get_segment_queue_space() != SEGMENT_QUEUE_SIZE)
+	{
+		/* Start the queued motion segments, on the ramp of the last parameters */
+		start_queued_segments();
+	}
+	
+	if (get_velocity_mode())
+	{
+		/* Ramp the velocity toward the target velocity */
+		/* The step ISR takes the update at the next pulse */
+		update_velocity_mode();
 	}
 }
 
@@ -274,7 +401,7 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 	
 	/* Receive data */
 	(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();	
-
+	
 	/* Return success */
 	return true;
 }
@@ -291,11 +418,11 @@ bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint1
 	/* Check if type matches */
 	if (app_regs_type[add-APP_REGS_ADD_MIN] != type)
 		return false;
-
+	
 	/* Check if the number of elements matches */
 	if (app_regs_n_elements[add-APP_REGS_ADD_MIN] != n_elements)
 		return false;
-
+	
 	/* Process data and return false if write is not allowed or contains errors */
 	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
 }
\ No newline at end of file
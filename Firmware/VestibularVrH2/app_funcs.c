@@ -4,6 +4,8 @@
 
 #include "encoder.h"
 #include "stepper_motor.h"
+#include "external_control.h"
+#include "instrumentation.h"
 
 /************************************************************************/
 /* Create pointers to functions                                         */
@@ -21,7 +23,40 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_ANALOG_INPUT,
 	&app_read_REG_STOP_SWITCH,
 	&app_read_REG_MOVING,
-	&app_read_REG_IMMEDIATE_PULSES
+	&app_read_REG_IMMEDIATE_PULSES,
+	&app_read_REG_PROFILE_TYPE,
+	&app_read_REG_ACCELERATION,
+	&app_read_REG_JERK,
+	&app_read_REG_SEGMENTS,
+	&app_read_REG_SEGMENT_QUEUE_SPACE,
+	&app_read_REG_POSITION,
+	&app_read_REG_MOVE_TO,
+	&app_read_REG_VELOCITY,
+	&app_read_REG_CLOSED_LOOP,
+	&app_read_REG_STEPS_PER_COUNT,
+	&app_read_REG_CLOSED_LOOP_GAINS,
+	&app_read_REG_POSITION_ERROR,
+	&app_read_REG_WAVEFORM_LENGTH,
+	&app_read_REG_WAVEFORM_SAMPLES,
+	&app_read_REG_WAVEFORM_SAMPLE_INTERVAL,
+	&app_read_REG_WAVEFORM_CONTROL,
+	&app_read_REG_OSCILLATION_AMPLITUDE,
+	&app_read_REG_OSCILLATION_FREQUENCY,
+	&app_read_REG_OSCILLATION_PHASE,
+	&app_read_REG_OSCILLATION_CYCLES,
+	&app_read_REG_STEP_GENERATOR,
+	&app_read_REG_HARDWARE_CRUISE,
+	&app_read_REG_ISR_STATISTICS,
+	&app_read_REG_TRACE_CONTROL,
+	&app_read_REG_TRACE_STEPS,
+	&app_read_REG_TRACE_INDEX,
+	&app_read_REG_TRACE_DATA,
+	&app_read_REG_SCHEDULED_START,
+	&app_read_REG_MOTION_COMMAND,
+	&app_read_REG_EXTERNAL_CONTROL,
+	&app_read_REG_EXTERNAL_BAUD_RATE,
+	&app_read_REG_EXTERNAL_STATISTICS,
+	&app_read_REG_ENCODER_VELOCITY
 };
 
 bool (*app_func_wr_pointer[])(void*) = {
@@ -35,7 +70,40 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_ANALOG_INPUT,
 	&app_write_REG_STOP_SWITCH,
 	&app_write_REG_MOVING,
-	&app_write_REG_IMMEDIATE_PULSES
+	&app_write_REG_IMMEDIATE_PULSES,
+	&app_write_REG_PROFILE_TYPE,
+	&app_write_REG_ACCELERATION,
+	&app_write_REG_JERK,
+	&app_write_REG_SEGMENTS,
+	&app_write_REG_SEGMENT_QUEUE_SPACE,
+	&app_write_REG_POSITION,
+	&app_write_REG_MOVE_TO,
+	&app_write_REG_VELOCITY,
+	&app_write_REG_CLOSED_LOOP,
+	&app_write_REG_STEPS_PER_COUNT,
+	&app_write_REG_CLOSED_LOOP_GAINS,
+	&app_write_REG_POSITION_ERROR,
+	&app_write_REG_WAVEFORM_LENGTH,
+	&app_write_REG_WAVEFORM_SAMPLES,
+	&app_write_REG_WAVEFORM_SAMPLE_INTERVAL,
+	&app_write_REG_WAVEFORM_CONTROL,
+	&app_write_REG_OSCILLATION_AMPLITUDE,
+	&app_write_REG_OSCILLATION_FREQUENCY,
+	&app_write_REG_OSCILLATION_PHASE,
+	&app_write_REG_OSCILLATION_CYCLES,
+	&app_write_REG_STEP_GENERATOR,
+	&app_write_REG_HARDWARE_CRUISE,
+	&app_write_REG_ISR_STATISTICS,
+	&app_write_REG_TRACE_CONTROL,
+	&app_write_REG_TRACE_STEPS,
+	&app_write_REG_TRACE_INDEX,
+	&app_write_REG_TRACE_DATA,
+	&app_write_REG_SCHEDULED_START,
+	&app_write_REG_MOTION_COMMAND,
+	&app_write_REG_EXTERNAL_CONTROL,
+	&app_write_REG_EXTERNAL_BAUD_RATE,
+	&app_write_REG_EXTERNAL_STATISTICS,
+	&app_write_REG_ENCODER_VELOCITY
 };
 
 
@@ -75,7 +143,7 @@ void app_read_REG_CONTROL(void)
 	{
 		temp |= B_DISABLE_QUAD_ENCODER;
 	}
-
+	
 	app_regs.REG_CONTROL = temp;
 }
 
@@ -95,6 +163,9 @@ bool app_write_REG_CONTROL(void *a)
 	if (reg & B_RESET_QUAD_ENCODER)
 	{
 		reset_quadrature_encoder();
+		
+		/* Start counting the closed loop error from the new encoder value */
+		reset_closed_loop(get_quadrature_encoder());
 	}
 	
 	if (temporary_reg_control & B_ENABLE_MOTOR)
@@ -116,23 +187,30 @@ bool app_write_REG_CONTROL(void *a)
 /************************************************************************/
 /* REG_PULSES                                                           */
 /************************************************************************/
-extern int32_t user_requested_steps;
 
 void app_read_REG_PULSES(void)
 {
 	//app_regs.REG_CONTROL = 0;
-
+	
 }
 
 bool app_write_REG_PULSES(void *a)
 {
 	int32_t reg = *((int32_t*)a);
 	
+	/* The motor is busy with the motion segments or the velocity mode */
+	if (get_segment_queue_space() != SEGMENT_QUEUE_SIZE) return false;
+	if (get_velocity_mode()) return false;
+	
+	/* The scheduled start already holds a waveform */
+	if (get_scheduled_start() > SCHEDULE_ARMED) return false;
+	
 	if (app_regs. REG_CONTROL & B_ENABLE_MOTOR)
 	{
-		user_requested_steps += reg;
+		/* Post the request right away, a running move takes it at the next pulse */
+		user_sent_request(reg);
 	}
-
+	
 	app_regs.REG_PULSES = reg;
 	return true;
 }
@@ -144,18 +222,21 @@ bool app_write_REG_PULSES(void *a)
 void app_read_REG_NOMINAL_PULSE_INTERVAL(void)
 {
 	//app_regs.REG_NOMINAL_PULSE_INTERVAL = 0;
-
+	
 }
 
 bool app_write_REG_NOMINAL_PULSE_INTERVAL(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+	uint32_t reg = *((uint32_t*)a);
 	
-	if (reg < 100) return false;
-	if (reg > 20000) return false;
+	if (reg < 20) return false;
+	if (reg > 2000000) return false;
+	
+	/* Must fit the TCC0 prescaler of the initial interval */
+	if (check_ramp_intervals(reg, app_regs.REG_INITIAL_PULSE_INTERVAL) == false) return false;
+	
+	if (TCC0.CTRLA && !get_ramped_move()) return false;	
 	
-	if (TCC0.CTRLA) return false;	
-
 	update_nominal_pulse_interval(reg);
 	
 	app_regs.REG_NOMINAL_PULSE_INTERVAL = reg;
@@ -169,20 +250,23 @@ bool app_write_REG_NOMINAL_PULSE_INTERVAL(void *a)
 void app_read_REG_INITIAL_PULSE_INTERVAL(void)
 {
 	//app_regs.REG_INITIAL_PULSE_INTERVAL = 0;
-
+	
 }
 
 bool app_write_REG_INITIAL_PULSE_INTERVAL(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+	uint32_t reg = *((uint32_t*)a);
 	
-	if (reg < 100) return false;
-	if (reg > 20000) return false;
+	if (reg < 20) return false;
+	if (reg > 2000000) return false;
 	
-	if (TCC0.CTRLA) return false;
+	/* The TCC0 prescaler it needs must still fit the nominal interval */
+	if (check_ramp_intervals(app_regs.REG_NOMINAL_PULSE_INTERVAL, reg) == false) return false;
+	
+	if (TCC0.CTRLA && !get_ramped_move()) return false;
 	
 	update_initial_pulse_interval(reg);
-
+	
 	app_regs.REG_INITIAL_PULSE_INTERVAL = reg;
 	return true;
 }
@@ -194,7 +278,7 @@ bool app_write_REG_INITIAL_PULSE_INTERVAL(void *a)
 void app_read_REG_PULSE_STEP_INTERVAL(void)
 {
 	//app_regs.REG_PULSE_STEP_INTERVAL = 0;
-
+	
 }
 
 bool app_write_REG_PULSE_STEP_INTERVAL(void *a)
@@ -204,7 +288,7 @@ bool app_write_REG_PULSE_STEP_INTERVAL(void *a)
 	if (reg < 2) return false;
 	if (reg > 2000) return false;
 	
-	if (TCC0.CTRLA) return false;
+	if (TCC0.CTRLA && !get_ramped_move()) return false;
 	
 	update_pulse_step_interval(reg);
 	
@@ -219,7 +303,7 @@ bool app_write_REG_PULSE_STEP_INTERVAL(void *a)
 void app_read_REG_PULSE_PERIOD(void)
 {
 	//app_regs.REG_PULSE_PERIOD = 0;
-
+	
 }
 
 bool app_write_REG_PULSE_PERIOD(void *a)
@@ -229,10 +313,10 @@ bool app_write_REG_PULSE_PERIOD(void *a)
 	if (reg < 10) return false;
 	if (reg > 1000) return false;
 	
-	if (TCC0.CTRLA) return false;
-
+	if (TCC0.CTRLA && !get_ramped_move()) return false;
+	
 	update_pulse_period(reg);
-
+	
 	app_regs.REG_PULSE_PERIOD = reg;
 	return true;
 }
@@ -244,7 +328,7 @@ bool app_write_REG_PULSE_PERIOD(void *a)
 void app_read_REG_ENCODER(void)
 {
 	//app_regs.REG_ENCODER = 0;
-
+	
 }
 
 bool app_write_REG_ENCODER(void *a)
@@ -252,7 +336,8 @@ bool app_write_REG_ENCODER(void *a)
 	int16_t reg = *((int16_t*)a);
 	
 	TCD1_CNT = 0x8000 + reg;
-
+	reset_encoder_velocity();
+	
 	app_regs.REG_ENCODER = reg;
 	return true;
 }
@@ -264,7 +349,7 @@ bool app_write_REG_ENCODER(void *a)
 void app_read_REG_ANALOG_INPUT(void)
 {
 	//app_regs.REG_ANALLOG_INPUT = 0;
-
+	
 }
 
 bool app_write_REG_ANALOG_INPUT(void *a)
@@ -307,49 +392,977 @@ bool app_write_REG_MOVING(void *a)
 void app_read_REG_IMMEDIATE_PULSES(void)
 {
 	//app_regs.REG_ENCODER = 0;
-
+	
 }
 
 bool app_write_REG_IMMEDIATE_PULSES(void *a)
 {
 	int16_t reg = *((int16_t*)a);
 	
+	if (get_velocity_mode()) return false;
+	if (get_scheduled_start()) return false;
+	if (get_move_waiting()) return false;
+	
 	if ((reg < 10 && reg > -10) && (reg != 0))
 	{
 		return false;
 	}
-	else if (reg == 0)
+	
+	if (reg == 0)
 	{
-		timer_type0_stop(&TCC0);
+		stop_rotation();
 	}
 	else
-	{		
-		if (TCC0_CTRLA == 0 || TCC0_INTCTRLB != 0)
-		{	
-			if (reg > 0)
-				set_MOTOR_DIRECTION;
-			else
-				clr_MOTOR_DIRECTION;
-			
-			if (reg < 0) reg = -reg;
-			
-			timer_type0_pwm(&TCC0, TIMER_PRESCALER_DIV64, reg >> 1, reg >> 2, INT_LEVEL_MED, INT_LEVEL_OFF);		
+	{
+		/* Starts the pulses or updates the interval at the next period */
+		set_immediate_pulses(reg);
+	}
+	
+	if (reg < 0) reg = -reg;
+	
+	app_regs.REG_IMMEDIATE_PULSES = reg;
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROFILE_TYPE                                                     */
+/************************************************************************/
+void app_read_REG_PROFILE_TYPE(void)
+{
+	//app_regs.REG_PROFILE_TYPE = 0;
+	
+}
+
+bool app_write_REG_PROFILE_TYPE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_PROFILE_CONSTANT_ACCELERATION) return false;
+	
+	if (TCC0.CTRLA && !get_ramped_move()) return false;
+	
+	update_profile_type(reg);
+	
+	app_regs.REG_PROFILE_TYPE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_ACCELERATION                                                     */
+/************************************************************************/
+void app_read_REG_ACCELERATION(void)
+{
+	//app_regs.REG_ACCELERATION = 0;
+	
+}
+
+bool app_write_REG_ACCELERATION(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	if (reg < 10) return false;
+	if (reg > 1000000) return false;
+	
+	if (TCC0.CTRLA && !get_ramped_move()) return false;
+	
+	update_acceleration(reg);
+	
+	app_regs.REG_ACCELERATION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_JERK                                                             */
+/************************************************************************/
+void app_read_REG_JERK(void)
+{
+	//app_regs.REG_JERK = 0;
+	
+}
+
+bool app_write_REG_JERK(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	if (reg < 10) return false;
+	if (reg > 100000000) return false;
+	
+	if (TCC0.CTRLA && !get_ramped_move()) return false;
+	
+	update_jerk(reg);
+	
+	app_regs.REG_JERK = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEGMENTS                                                         */
+/************************************************************************/
+void app_read_REG_SEGMENTS(void)
+{
+	//app_regs.REG_SEGMENTS[0] = 0;
+	
+}
+
+bool app_write_REG_SEGMENTS(void *a)
+{
+	int32_t *reg = ((int32_t*)a);
+	uint8_t n_segments = 0;
+	
+	if ((app_regs.REG_CONTROL & B_ENABLE_MOTOR) == false) return false;
+	
+	/* Not available while using the immediate pulses or the velocity mode */
+	if (get_immediate_mode()) return false;
+	if (get_velocity_mode()) return false;
+	
+	/* The scheduled start already holds a waveform */
+	if (get_scheduled_start() > SCHEDULE_ARMED) return false;
+	
+	/* Each segment is [steps, pulse interval], segments with 0 steps are ignored */
+	/* A pulse interval of 0 uses the nominal pulse interval */
+	for (uint8_t i = 0; i < 8; i += 2)
+	{
+		if (reg[i] == 0)
+			continue;
+		
+		if (reg[i+1] != 0)
+		{
+			if (reg[i+1] < app_regs.REG_NOMINAL_PULSE_INTERVAL) return false;
+			if (reg[i+1] > app_regs.REG_INITIAL_PULSE_INTERVAL) return false;
 		}
-		else if (TCC0_CTRLA != 0 || TCC0_INTCTRLB == 0) // TCC0_INTCTRLB == 0 (meaning no CCA interrupt) is only used on this immediate_pulses mode
+		
+		n_segments++;
+	}
+	
+	if (n_segments > get_segment_queue_space()) return false;
+	
+	/* Disable medium and high level interrupts */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
+	
+	for (uint8_t i = 0; i < 8; i += 2)
+	{
+		if (reg[i] != 0)
 		{
-			if (reg > 0)
-				set_MOTOR_DIRECTION;
-			else
-				clr_MOTOR_DIRECTION;
-			
-			if (reg < 0) reg = -reg;
-			
-			//TCC0_PER = (reg >> 1) - 1;
-			//TCC0_CCA = reg >> 2;
+			enqueue_motion_segment(reg[i], (reg[i+1] != 0) ? reg[i+1] : app_regs.REG_NOMINAL_PULSE_INTERVAL);
 		}
 	}
+	
+	/* Re-enable all interrupt levels */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+	
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		app_regs.REG_SEGMENTS[i] = reg[i];
+	}
+	
+	return true;
+}
 
-	app_regs.REG_IMMEDIATE_PULSES = reg;
+
+/************************************************************************/
+/* REG_SEGMENT_QUEUE_SPACE                                              */
+/************************************************************************/
+void app_read_REG_SEGMENT_QUEUE_SPACE(void)
+{
+	app_regs.REG_SEGMENT_QUEUE_SPACE = get_segment_queue_space();
+}
+
+bool app_write_REG_SEGMENT_QUEUE_SPACE(void *a)
+{
+	return false;
+}
+
+/************************************************************************/
+/* REG_POSITION                                                         */
+/************************************************************************/
+void app_read_REG_POSITION(void)
+{
+	app_regs.REG_POSITION = get_motor_position();
+}
+
+bool app_write_REG_POSITION(void *a)
+{
+	int32_t reg = *((int32_t*)a);
+	
+	/* The position can only be set while the motor is stopped */
+	if (TCC0.CTRLA) return false;
+	if (get_velocity_mode()) return false;
+	if (get_move_waiting()) return false;
+	if (get_segment_queue_space() != SEGMENT_QUEUE_SIZE) return false;
+	
+	set_motor_position(reg);
+	
+	app_regs.REG_POSITION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MOVE_TO                                                          */
+/************************************************************************/
+void app_read_REG_MOVE_TO(void)
+{
+	//app_regs.REG_MOVE_TO = 0;
+	
+}
+
+bool app_write_REG_MOVE_TO(void *a)
+{
+	int32_t reg = *((int32_t*)a);
+	
+	if ((app_regs.REG_CONTROL & B_ENABLE_MOTOR) == false) return false;
+	
+	/* Not available while using the immediate pulses, the motion segments or the velocity mode */
+	if (get_immediate_mode()) return false;
+	if (get_segment_queue_space() != SEGMENT_QUEUE_SIZE) return false;
+	if (get_velocity_mode()) return false;
+	
+	/* The scheduled start already holds a waveform */
+	if (get_scheduled_start() > SCHEDULE_ARMED) return false;
+	
+	/* Plan the move from the position where the pending requests will leave the motor */
+	/* A running move takes it at the next pulse */
+	user_sent_request(reg - get_final_motor_position());
+	
+	app_regs.REG_MOVE_TO = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VELOCITY                                                         */
+/************************************************************************/
+void app_read_REG_VELOCITY(void)
+{
+	//app_regs.REG_VELOCITY = 0;
+	
+}
+
+bool app_write_REG_VELOCITY(void *a)
+{
+	int16_t reg = *((int16_t*)a);
+	
+	if ((app_regs.REG_CONTROL & B_ENABLE_MOTOR) == false) return false;
+	
+	/* Limited to the nominal speed */
+	if (reg > 0 && (uint32_t)reg > 1000000 / app_regs.REG_NOMINAL_PULSE_INTERVAL) return false;
+	if (reg < 0 && (uint32_t)(-reg) > 1000000 / app_regs.REG_NOMINAL_PULSE_INTERVAL) return false;
+	
+	/* Not available while other moves are running or scheduled */
+	if (TCC0_CTRLA && get_velocity_mode() == false) return false;
+	if (get_waveform_playing()) return false;
+	if (get_move_waiting()) return false;
+	if (get_segment_queue_space() != SEGMENT_QUEUE_SIZE) return false;
+	if (get_scheduled_start()) return false;
+	
+	set_target_velocity(reg);
+	
+	app_regs.REG_VELOCITY = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CLOSED_LOOP                                                      */
+/************************************************************************/
+void app_read_REG_CLOSED_LOOP(void)
+{
+	//app_regs.REG_CLOSED_LOOP = 0;
+	
+}
+
+bool app_write_REG_CLOSED_LOOP(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~B_ENABLE_CLOSED_LOOP) return false;
+	
+	set_closed_loop(reg & B_ENABLE_CLOSED_LOOP, get_quadrature_encoder());
+	
+	app_regs.REG_CLOSED_LOOP = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STEPS_PER_COUNT                                                  */
+/************************************************************************/
+void app_read_REG_STEPS_PER_COUNT(void)
+{
+	//app_regs.REG_STEPS_PER_COUNT = 0;
+	
+}
+
+bool app_write_REG_STEPS_PER_COUNT(void *a)
+{
+	int16_t reg = *((int16_t*)a);
+	
+	if (reg == 0) return false;
+	
+	/* The error would jump if the ratio changes while in use */
+	if (app_regs.REG_CLOSED_LOOP & B_ENABLE_CLOSED_LOOP) return false;
+	
+	update_steps_per_count(reg);
+	
+	app_regs.REG_STEPS_PER_COUNT = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CLOSED_LOOP_GAINS                                                */
+/************************************************************************/
+void app_read_REG_CLOSED_LOOP_GAINS(void)
+{
+	//app_regs.REG_CLOSED_LOOP_GAINS[0] = 0;
+	
+}
+
+bool app_write_REG_CLOSED_LOOP_GAINS(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	/* Gains up to 16 */
+	if (reg[0] > 0x1000) return false;
+	if (reg[1] > 0x1000) return false;
+	
+	update_closed_loop_gains(reg[0], reg[1]);
 	
+	app_regs.REG_CLOSED_LOOP_GAINS[0] = reg[0];
+	app_regs.REG_CLOSED_LOOP_GAINS[1] = reg[1];
 	return true;
-}
\ No newline at end of file
+}
+
+
+/************************************************************************/
+/* REG_POSITION_ERROR                                                   */
+/************************************************************************/
+void app_read_REG_POSITION_ERROR(void)
+{
+	app_regs.REG_POSITION_ERROR = get_position_error();
+}
+
+bool app_write_REG_POSITION_ERROR(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_LENGTH                                                  */
+/************************************************************************/
+void app_read_REG_WAVEFORM_LENGTH(void)
+{
+	//app_regs.REG_WAVEFORM_LENGTH = 0;
+	
+}
+
+bool app_write_REG_WAVEFORM_LENGTH(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg > WAVEFORM_SIZE) return false;
+	
+	if (get_waveform_playing()) return false;
+	
+	clear_waveform(reg);
+	
+	app_regs.REG_WAVEFORM_LENGTH = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_SAMPLES                                                 */
+/************************************************************************/
+void app_read_REG_WAVEFORM_SAMPLES(void)
+{
+	//app_regs.REG_WAVEFORM_SAMPLES[0] = 0;
+	
+}
+
+bool app_write_REG_WAVEFORM_SAMPLES(void *a)
+{
+	int16_t *reg = ((int16_t*)a);
+	uint16_t n_samples = app_regs.REG_WAVEFORM_LENGTH - get_waveform_upload_index();
+	
+	if (get_waveform_playing()) return false;
+	
+	/* The waveform is already complete */
+	if (n_samples == 0) return false;
+	
+	if (n_samples > 32) n_samples = 32;
+	
+	/* Limited to the nominal speed */
+	for (uint8_t i = 0; i < n_samples; i++)
+	{
+		if (reg[i] > 0 && (uint32_t)reg[i] > 1000000 / app_regs.REG_NOMINAL_PULSE_INTERVAL) return false;
+		if (reg[i] < 0 && (uint32_t)(-reg[i]) > 1000000 / app_regs.REG_NOMINAL_PULSE_INTERVAL) return false;
+	}
+	
+	append_waveform_samples(reg, n_samples);
+	
+	for (uint8_t i = 0; i < 32; i++)
+	{
+		app_regs.REG_WAVEFORM_SAMPLES[i] = reg[i];
+	}
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_SAMPLE_INTERVAL                                         */
+/************************************************************************/
+void app_read_REG_WAVEFORM_SAMPLE_INTERVAL(void)
+{
+	//app_regs.REG_WAVEFORM_SAMPLE_INTERVAL = 0;
+	
+}
+
+bool app_write_REG_WAVEFORM_SAMPLE_INTERVAL(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg < 100) return false;
+	
+	if (get_waveform_playing()) return false;
+	
+	update_waveform_sample_interval(reg);
+	
+	app_regs.REG_WAVEFORM_SAMPLE_INTERVAL = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_CONTROL                                                 */
+/************************************************************************/
+void app_read_REG_WAVEFORM_CONTROL(void)
+{
+	app_regs.REG_WAVEFORM_CONTROL = (get_waveform_playing()) ? B_START_WAVEFORM : B_STOP_WAVEFORM;
+}
+
+bool app_write_REG_WAVEFORM_CONTROL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & B_STOP_WAVEFORM)
+	{
+		if (get_waveform_playing())
+		{
+			stop_rotation();
+		}
+	}
+	else if (reg & (B_START_WAVEFORM | B_START_OSCILLATION))
+	{
+		if ((app_regs.REG_CONTROL & B_ENABLE_MOTOR) == false) return false;
+		
+		if (reg & B_START_OSCILLATION)
+		{
+			/* At least four samples per cycle */
+			if ((uint32_t)app_regs.REG_OSCILLATION_FREQUENCY * app_regs.REG_WAVEFORM_SAMPLE_INTERVAL > 250000000) return false;
+		}
+		else
+		{
+			/* The waveform must be completely uploaded */
+			if (app_regs.REG_WAVEFORM_LENGTH == 0) return false;
+			if (get_waveform_upload_index() != app_regs.REG_WAVEFORM_LENGTH) return false;
+		}
+		
+		/* Not available while other moves are running */
+		if (TCC0_CTRLA) return false;
+		if (get_velocity_mode()) return false;
+		if (get_move_waiting()) return false;
+		if (get_segment_queue_space() != SEGMENT_QUEUE_SIZE) return false;
+		
+		if (get_scheduled_start())
+		{
+			/* Wait for the scheduled start, unless it already holds a move */
+			if (reg & B_START_OSCILLATION)
+			{
+				if (!schedule_oscillation(app_regs.REG_OSCILLATION_AMPLITUDE, app_regs.REG_OSCILLATION_FREQUENCY, app_regs.REG_OSCILLATION_PHASE, app_regs.REG_OSCILLATION_CYCLES)) return false;
+			}
+			else
+			{
+				if (!schedule_waveform(reg & B_LOOP_WAVEFORM)) return false;
+			}
+			
+			app_regs.REG_WAVEFORM_CONTROL = reg;
+			return true;
+		}
+		
+		if (reg & B_START_OSCILLATION)
+		{
+			start_oscillation(app_regs.REG_OSCILLATION_AMPLITUDE, app_regs.REG_OSCILLATION_FREQUENCY, app_regs.REG_OSCILLATION_PHASE, app_regs.REG_OSCILLATION_CYCLES);
+		}
+		else
+		{
+			start_waveform(reg & B_LOOP_WAVEFORM);
+		}
+	}
+	
+	app_regs.REG_WAVEFORM_CONTROL = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_OSCILLATION_AMPLITUDE                                            */
+/************************************************************************/
+void app_read_REG_OSCILLATION_AMPLITUDE(void)
+{
+	//app_regs.REG_OSCILLATION_AMPLITUDE = 0;
+	
+}
+
+bool app_write_REG_OSCILLATION_AMPLITUDE(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	/* Limited to the nominal speed */
+	if ((uint32_t)reg > 1000000 / app_regs.REG_NOMINAL_PULSE_INTERVAL) return false;
+	
+	if (get_waveform_playing()) return false;
+	
+	app_regs.REG_OSCILLATION_AMPLITUDE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_OSCILLATION_FREQUENCY                                            */
+/************************************************************************/
+void app_read_REG_OSCILLATION_FREQUENCY(void)
+{
+	//app_regs.REG_OSCILLATION_FREQUENCY = 0;
+	
+}
+
+bool app_write_REG_OSCILLATION_FREQUENCY(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg == 0) return false;
+	
+	if (get_waveform_playing()) return false;
+	
+	app_regs.REG_OSCILLATION_FREQUENCY = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_OSCILLATION_PHASE                                                */
+/************************************************************************/
+void app_read_REG_OSCILLATION_PHASE(void)
+{
+	//app_regs.REG_OSCILLATION_PHASE = 0;
+	
+}
+
+bool app_write_REG_OSCILLATION_PHASE(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (get_waveform_playing()) return false;
+	
+	app_regs.REG_OSCILLATION_PHASE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_OSCILLATION_CYCLES                                               */
+/************************************************************************/
+void app_read_REG_OSCILLATION_CYCLES(void)
+{
+	//app_regs.REG_OSCILLATION_CYCLES = 0;
+	
+}
+
+bool app_write_REG_OSCILLATION_CYCLES(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (get_waveform_playing()) return false;
+	
+	app_regs.REG_OSCILLATION_CYCLES = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STEP_GENERATOR                                                   */
+/************************************************************************/
+void app_read_REG_STEP_GENERATOR(void)
+{
+	//app_regs.REG_STEP_GENERATOR = 0;
+	
+}
+
+bool app_write_REG_STEP_GENERATOR(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_GENERATOR_DDS) return false;
+	
+	if (TCC0.CTRLA) return false;
+	if (get_velocity_mode()) return false;
+	
+	update_step_generator(reg);
+	
+	app_regs.REG_STEP_GENERATOR = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_HARDWARE_CRUISE                                                  */
+/************************************************************************/
+void app_read_REG_HARDWARE_CRUISE(void)
+{
+	//app_regs.REG_HARDWARE_CRUISE = 0;
+	
+}
+
+bool app_write_REG_HARDWARE_CRUISE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~B_ENABLE_HARDWARE_CRUISE) return false;
+	
+	if (TCC0.CTRLA) return false;
+	
+	update_hardware_cruise(reg & B_ENABLE_HARDWARE_CRUISE);
+	
+	app_regs.REG_HARDWARE_CRUISE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_ISR_STATISTICS                                                   */
+/************************************************************************/
+void app_read_REG_ISR_STATISTICS(void)
+{
+	/* Disable medium and high level interrupts */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
+	
+	get_isr_statistics(app_regs.REG_ISR_STATISTICS);
+	
+	/* Re-enable all interrupt levels */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+}
+
+bool app_write_REG_ISR_STATISTICS(void *a)
+{
+	/* Disable medium and high level interrupts */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
+	
+	/* Any write resets the statistics */
+	reset_isr_statistics();
+	
+	/* Re-enable all interrupt levels */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+	
+	get_isr_statistics(app_regs.REG_ISR_STATISTICS);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TRACE_CONTROL                                                    */
+/************************************************************************/
+void app_read_REG_TRACE_CONTROL(void)
+{
+	//app_regs.REG_TRACE_CONTROL = 0;
+	
+}
+
+bool app_write_REG_TRACE_CONTROL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~B_ENABLE_TRACE) return false;
+	
+	/* Disable medium and high level interrupts */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
+	
+	set_step_trace(reg & B_ENABLE_TRACE);
+	
+	/* Re-enable all interrupt levels */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+	
+	app_regs.REG_TRACE_INDEX = 0;
+	
+	app_regs.REG_TRACE_CONTROL = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TRACE_STEPS                                                      */
+/************************************************************************/
+void app_read_REG_TRACE_STEPS(void)
+{
+	/* Disable medium and high level interrupts */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
+	
+	app_regs.REG_TRACE_STEPS = get_step_trace_steps();
+	
+	/* Re-enable all interrupt levels */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+}
+
+bool app_write_REG_TRACE_STEPS(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_TRACE_INDEX                                                      */
+/************************************************************************/
+void app_read_REG_TRACE_INDEX(void)
+{
+	//app_regs.REG_TRACE_INDEX = 0;
+	
+}
+
+bool app_write_REG_TRACE_INDEX(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg >= STEP_TRACE_SIZE) return false;
+	
+	app_regs.REG_TRACE_INDEX = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TRACE_DATA                                                       */
+/************************************************************************/
+void app_read_REG_TRACE_DATA(void)
+{
+	/* Disable medium and high level interrupts */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
+	
+	read_step_trace(app_regs.REG_TRACE_INDEX, app_regs.REG_TRACE_DATA, 16);
+	
+	/* Re-enable all interrupt levels */
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+	
+	/* The next read continues with the following steps */
+	app_regs.REG_TRACE_INDEX += 16;
+}
+
+bool app_write_REG_TRACE_DATA(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_SCHEDULED_START                                                  */
+/************************************************************************/
+void app_read_REG_SCHEDULED_START(void)
+{
+	/* Zeros once the start happened or was canceled */
+	if (get_scheduled_start() == SCHEDULE_OFF)
+	{
+		app_regs.REG_SCHEDULED_START[0] = 0;
+		app_regs.REG_SCHEDULED_START[1] = 0;
+	}
+}
+
+bool app_write_REG_SCHEDULED_START(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+	bool scheduled;
+	
+	if (reg[0] == 0 && reg[1] == 0)
+	{
+		if (get_scheduled_start() && TCC0_CTRLA == 0)
+		{
+			/* Discard the scheduled start and the move waiting for it */
+			stop_rotation();
+		}
+	}
+	else
+	{
+		if ((app_regs.REG_CONTROL & B_ENABLE_MOTOR) == false) return false;
+		
+		/* Only one start can be scheduled and only while the motor is stopped */
+		if (get_scheduled_start()) return false;
+		if (TCC0_CTRLA) return false;
+		if (get_velocity_mode()) return false;
+		if (get_move_waiting()) return false;
+		if (get_segment_queue_space() != SEGMENT_QUEUE_SIZE) return false;
+		
+		/* Disable medium and high level interrupts */
+		PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm;
+		
+		scheduled = schedule_start(reg[0], reg[1]);
+		
+		/* Re-enable all interrupt levels */
+		PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+		
+		/* The timestamp must be at least 1 ms in the future */
+		if (scheduled == false) return false;
+	}
+	
+	app_regs.REG_SCHEDULED_START[0] = reg[0];
+	app_regs.REG_SCHEDULED_START[1] = reg[1];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MOTION_COMMAND                                                   */
+/************************************************************************/
+void app_read_REG_MOTION_COMMAND(void)
+{
+	/* The current parameters, which may have been written one by one */
+	app_regs.REG_MOTION_COMMAND[0] = 0;
+	app_regs.REG_MOTION_COMMAND[1] = app_regs.REG_NOMINAL_PULSE_INTERVAL;
+	app_regs.REG_MOTION_COMMAND[2] = app_regs.REG_INITIAL_PULSE_INTERVAL;
+	app_regs.REG_MOTION_COMMAND[3] = app_regs.REG_PULSE_STEP_INTERVAL;
+	app_regs.REG_MOTION_COMMAND[4] = app_regs.REG_PULSE_PERIOD;
+	app_regs.REG_MOTION_COMMAND[5] = app_regs.REG_PROFILE_TYPE;
+	app_regs.REG_MOTION_COMMAND[6] = app_regs.REG_ACCELERATION;
+	app_regs.REG_MOTION_COMMAND[7] = app_regs.REG_JERK;
+}
+
+bool app_write_REG_MOTION_COMMAND(void *a)
+{
+	int32_t *reg = ((int32_t*)a);
+	
+	if ((app_regs.REG_CONTROL & B_ENABLE_MOTOR) == false) return false;
+	
+	/* Same limits of the registers of each parameter */
+	if (reg[1] < 20 || reg[1] > 2000000) return false;
+	if (reg[2] < 20 || reg[2] > 2000000) return false;
+	if (reg[3] < 2 || reg[3] > 2000) return false;
+	if (reg[4] < 10 || reg[4] > 1000) return false;
+	if (reg[5] < 0 || reg[5] > GM_PROFILE_CONSTANT_ACCELERATION) return false;
+	if (reg[6] < 10 || reg[6] > 1000000) return false;
+	if (reg[7] < 10 || reg[7] > 100000000) return false;
+	if (check_ramp_intervals(reg[1], reg[2]) == false) return false;
+	
+	/* A running move must be a ramped one */
+	if (TCC0.CTRLA && !get_ramped_move()) return false;
+	if (get_velocity_mode()) return false;
+	if (get_immediate_mode()) return false;
+	if (get_segment_queue_space() != SEGMENT_QUEUE_SIZE) return false;
+	
+	/* The scheduled start already holds a waveform */
+	if (get_scheduled_start() > SCHEDULE_ARMED) return false;
+	
+	/* The new table is staged while the motor runs or a start is scheduled, */
+	/* and the step ISR takes it with the request at the next pulse          */
+	update_motion_parameters(reg[1], reg[2], reg[3], reg[4], reg[5], reg[6], reg[7]);
+	
+	app_regs.REG_NOMINAL_PULSE_INTERVAL = reg[1];
+	app_regs.REG_INITIAL_PULSE_INTERVAL = reg[2];
+	app_regs.REG_PULSE_STEP_INTERVAL = reg[3];
+	app_regs.REG_PULSE_PERIOD = reg[4];
+	app_regs.REG_PROFILE_TYPE = reg[5];
+	app_regs.REG_ACCELERATION = reg[6];
+	app_regs.REG_JERK = reg[7];
+	
+	/* Zero steps only sets the parameters */
+	if (reg[0] != 0)
+	{
+		user_sent_request(reg[0]);
+	}
+	
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		app_regs.REG_MOTION_COMMAND[i] = reg[i];
+	}
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EXTERNAL_CONTROL                                                 */
+/************************************************************************/
+void app_read_REG_EXTERNAL_CONTROL(void)
+{
+	//app_regs.REG_EXTERNAL_CONTROL = 0;
+	
+}
+
+bool app_write_REG_EXTERNAL_CONTROL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_EXTERNAL_CONTROL) return false;
+	
+	start_external_control(reg);
+	
+	app_regs.REG_EXTERNAL_CONTROL = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EXTERNAL_BAUD_RATE                                               */
+/************************************************************************/
+void app_read_REG_EXTERNAL_BAUD_RATE(void)
+{
+	//app_regs.REG_EXTERNAL_BAUD_RATE = 0;
+	
+}
+
+bool app_write_REG_EXTERNAL_BAUD_RATE(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Only the baud rates within 2 % with the 32 MHz clock */
+	if (set_external_baud_rate(reg) == false) return false;
+	
+	app_regs.REG_EXTERNAL_BAUD_RATE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EXTERNAL_STATISTICS                                              */
+/************************************************************************/
+void app_read_REG_EXTERNAL_STATISTICS(void)
+{
+	get_external_statistics(app_regs.REG_EXTERNAL_STATISTICS);
+}
+
+bool app_write_REG_EXTERNAL_STATISTICS(void *a)
+{
+	/* Any write resets the statistics */
+	reset_external_statistics();
+	
+	get_external_statistics(app_regs.REG_EXTERNAL_STATISTICS);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_ENCODER_VELOCITY                                                 */
+/************************************************************************/
+void app_read_REG_ENCODER_VELOCITY(void)
+{
+	//app_regs.REG_ENCODER_VELOCITY = 0;
+	
+}
+
+bool app_write_REG_ENCODER_VELOCITY(void *a)
+{
+	return false;
+}
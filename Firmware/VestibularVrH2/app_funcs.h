@@ -31,6 +31,39 @@ void app_read_REG_ANALOG_INPUT(void);
 void app_read_REG_STOP_SWITCH(void);
 void app_read_REG_MOVING(void);
 void app_read_REG_IMMEDIATE_PULSES(void);
+void app_read_REG_PROFILE_TYPE(void);
+void app_read_REG_ACCELERATION(void);
+void app_read_REG_JERK(void);
+void app_read_REG_SEGMENTS(void);
+void app_read_REG_SEGMENT_QUEUE_SPACE(void);
+void app_read_REG_POSITION(void);
+void app_read_REG_MOVE_TO(void);
+void app_read_REG_VELOCITY(void);
+void app_read_REG_CLOSED_LOOP(void);
+void app_read_REG_STEPS_PER_COUNT(void);
+void app_read_REG_CLOSED_LOOP_GAINS(void);
+void app_read_REG_POSITION_ERROR(void);
+void app_read_REG_WAVEFORM_LENGTH(void);
+void app_read_REG_WAVEFORM_SAMPLES(void);
+void app_read_REG_WAVEFORM_SAMPLE_INTERVAL(void);
+void app_read_REG_WAVEFORM_CONTROL(void);
+void app_read_REG_OSCILLATION_AMPLITUDE(void);
+void app_read_REG_OSCILLATION_FREQUENCY(void);
+void app_read_REG_OSCILLATION_PHASE(void);
+void app_read_REG_OSCILLATION_CYCLES(void);
+void app_read_REG_STEP_GENERATOR(void);
+void app_read_REG_HARDWARE_CRUISE(void);
+void app_read_REG_ISR_STATISTICS(void);
+void app_read_REG_TRACE_CONTROL(void);
+void app_read_REG_TRACE_STEPS(void);
+void app_read_REG_TRACE_INDEX(void);
+void app_read_REG_TRACE_DATA(void);
+void app_read_REG_SCHEDULED_START(void);
+void app_read_REG_MOTION_COMMAND(void);
+void app_read_REG_EXTERNAL_CONTROL(void);
+void app_read_REG_EXTERNAL_BAUD_RATE(void);
+void app_read_REG_EXTERNAL_STATISTICS(void);
+void app_read_REG_ENCODER_VELOCITY(void);
 
 
 bool app_write_REG_CONTROL(void *a);
@@ -44,6 +77,39 @@ bool app_write_REG_ANALOG_INPUT(void *a);
 bool app_write_REG_STOP_SWITCH(void *a);
 bool app_write_REG_MOVING(void *a);
 bool app_write_REG_IMMEDIATE_PULSES(void *a);
+bool app_write_REG_PROFILE_TYPE(void *a);
+bool app_write_REG_ACCELERATION(void *a);
+bool app_write_REG_JERK(void *a);
+bool app_write_REG_SEGMENTS(void *a);
+bool app_write_REG_SEGMENT_QUEUE_SPACE(void *a);
+bool app_write_REG_POSITION(void *a);
+bool app_write_REG_MOVE_TO(void *a);
+bool app_write_REG_VELOCITY(void *a);
+bool app_write_REG_CLOSED_LOOP(void *a);
+bool app_write_REG_STEPS_PER_COUNT(void *a);
+bool app_write_REG_CLOSED_LOOP_GAINS(void *a);
+bool app_write_REG_POSITION_ERROR(void *a);
+bool app_write_REG_WAVEFORM_LENGTH(void *a);
+bool app_write_REG_WAVEFORM_SAMPLES(void *a);
+bool app_write_REG_WAVEFORM_SAMPLE_INTERVAL(void *a);
+bool app_write_REG_WAVEFORM_CONTROL(void *a);
+bool app_write_REG_OSCILLATION_AMPLITUDE(void *a);
+bool app_write_REG_OSCILLATION_FREQUENCY(void *a);
+bool app_write_REG_OSCILLATION_PHASE(void *a);
+bool app_write_REG_OSCILLATION_CYCLES(void *a);
+bool app_write_REG_STEP_GENERATOR(void *a);
+bool app_write_REG_HARDWARE_CRUISE(void *a);
+bool app_write_REG_ISR_STATISTICS(void *a);
+bool app_write_REG_TRACE_CONTROL(void *a);
+bool app_write_REG_TRACE_STEPS(void *a);
+bool app_write_REG_TRACE_INDEX(void *a);
+bool app_write_REG_TRACE_DATA(void *a);
+bool app_write_REG_SCHEDULED_START(void *a);
+bool app_write_REG_MOTION_COMMAND(void *a);
+bool app_write_REG_EXTERNAL_CONTROL(void *a);
+bool app_write_REG_EXTERNAL_BAUD_RATE(void *a);
+bool app_write_REG_EXTERNAL_STATISTICS(void *a);
+bool app_write_REG_ENCODER_VELOCITY(void *a);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
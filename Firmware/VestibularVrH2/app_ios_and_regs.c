@@ -32,15 +32,48 @@ AppRegs app_regs;
 uint8_t app_regs_type[] = {
 	TYPE_U8,
 	TYPE_I32,
+	TYPE_U32,
+	TYPE_U32,
 	TYPE_U16,
 	TYPE_U16,
+	TYPE_I16,
+	TYPE_I16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_I16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_I32,
+	TYPE_U8,
+	TYPE_I32,
+	TYPE_I32,
+	TYPE_I16,
+	TYPE_U8,
+	TYPE_I16,
 	TYPE_U16,
+	TYPE_I32,
 	TYPE_U16,
 	TYPE_I16,
-	TYPE_I16,
+	TYPE_U16,
 	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_I32,
 	TYPE_U8,
-	TYPE_I16
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_I32
 };
 
 uint16_t app_regs_n_elements[] = {
@@ -54,6 +87,39 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	1,
+	1,
+	1,
+	1,
+	8,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	1,
+	1,
+	32,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	21,
+	1,
+	1,
+	1,
+	16,
+	2,
+	8,
+	1,
+	1,
+	5,
 	1
 };
 
@@ -68,5 +134,38 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_ANALOG_INPUT),
 	(uint8_t*)(&app_regs.REG_STOP_SWITCH),
 	(uint8_t*)(&app_regs.REG_MOVING),
-	(uint8_t*)(&app_regs.REG_IMMEDIATE_PULSES)
+	(uint8_t*)(&app_regs.REG_IMMEDIATE_PULSES),
+	(uint8_t*)(&app_regs.REG_PROFILE_TYPE),
+	(uint8_t*)(&app_regs.REG_ACCELERATION),
+	(uint8_t*)(&app_regs.REG_JERK),
+	(uint8_t*)(app_regs.REG_SEGMENTS),
+	(uint8_t*)(&app_regs.REG_SEGMENT_QUEUE_SPACE),
+	(uint8_t*)(&app_regs.REG_POSITION),
+	(uint8_t*)(&app_regs.REG_MOVE_TO),
+	(uint8_t*)(&app_regs.REG_VELOCITY),
+	(uint8_t*)(&app_regs.REG_CLOSED_LOOP),
+	(uint8_t*)(&app_regs.REG_STEPS_PER_COUNT),
+	(uint8_t*)(app_regs.REG_CLOSED_LOOP_GAINS),
+	(uint8_t*)(&app_regs.REG_POSITION_ERROR),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_LENGTH),
+	(uint8_t*)(app_regs.REG_WAVEFORM_SAMPLES),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_SAMPLE_INTERVAL),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_CONTROL),
+	(uint8_t*)(&app_regs.REG_OSCILLATION_AMPLITUDE),
+	(uint8_t*)(&app_regs.REG_OSCILLATION_FREQUENCY),
+	(uint8_t*)(&app_regs.REG_OSCILLATION_PHASE),
+	(uint8_t*)(&app_regs.REG_OSCILLATION_CYCLES),
+	(uint8_t*)(&app_regs.REG_STEP_GENERATOR),
+	(uint8_t*)(&app_regs.REG_HARDWARE_CRUISE),
+	(uint8_t*)(app_regs.REG_ISR_STATISTICS),
+	(uint8_t*)(&app_regs.REG_TRACE_CONTROL),
+	(uint8_t*)(&app_regs.REG_TRACE_STEPS),
+	(uint8_t*)(&app_regs.REG_TRACE_INDEX),
+	(uint8_t*)(app_regs.REG_TRACE_DATA),
+	(uint8_t*)(app_regs.REG_SCHEDULED_START),
+	(uint8_t*)(app_regs.REG_MOTION_COMMAND),
+	(uint8_t*)(&app_regs.REG_EXTERNAL_CONTROL),
+	(uint8_t*)(&app_regs.REG_EXTERNAL_BAUD_RATE),
+	(uint8_t*)(app_regs.REG_EXTERNAL_STATISTICS),
+	(uint8_t*)(&app_regs.REG_ENCODER_VELOCITY)
 };
\ No newline at end of file
@@ -43,8 +43,8 @@ typedef struct
 {
 	uint8_t REG_CONTROL;
 	int32_t REG_PULSES;
-	uint16_t REG_NOMINAL_PULSE_INTERVAL;
-	uint16_t REG_INITIAL_PULSE_INTERVAL;
+	uint32_t REG_NOMINAL_PULSE_INTERVAL;
+	uint32_t REG_INITIAL_PULSE_INTERVAL;
 	uint16_t REG_PULSE_STEP_INTERVAL;
 	uint16_t REG_PULSE_PERIOD;
 	int16_t REG_ENCODER;
@@ -52,6 +52,39 @@ typedef struct
 	uint8_t REG_STOP_SWITCH;
 	uint8_t REG_MOVING;
 	int16_t REG_IMMEDIATE_PULSES;
+	uint8_t REG_PROFILE_TYPE;
+	uint32_t REG_ACCELERATION;
+	uint32_t REG_JERK;
+	int32_t REG_SEGMENTS[8];
+	uint8_t REG_SEGMENT_QUEUE_SPACE;
+	int32_t REG_POSITION;
+	int32_t REG_MOVE_TO;
+	int16_t REG_VELOCITY;
+	uint8_t REG_CLOSED_LOOP;
+	int16_t REG_STEPS_PER_COUNT;
+	uint16_t REG_CLOSED_LOOP_GAINS[2];
+	int32_t REG_POSITION_ERROR;
+	uint16_t REG_WAVEFORM_LENGTH;
+	int16_t REG_WAVEFORM_SAMPLES[32];
+	uint16_t REG_WAVEFORM_SAMPLE_INTERVAL;
+	uint8_t REG_WAVEFORM_CONTROL;
+	uint16_t REG_OSCILLATION_AMPLITUDE;
+	uint16_t REG_OSCILLATION_FREQUENCY;
+	uint16_t REG_OSCILLATION_PHASE;
+	uint16_t REG_OSCILLATION_CYCLES;
+	uint8_t REG_STEP_GENERATOR;
+	uint8_t REG_HARDWARE_CRUISE;
+	uint16_t REG_ISR_STATISTICS[21];
+	uint8_t REG_TRACE_CONTROL;
+	uint32_t REG_TRACE_STEPS;
+	uint16_t REG_TRACE_INDEX;
+	uint32_t REG_TRACE_DATA[16];
+	uint32_t REG_SCHEDULED_START[2];
+	int32_t REG_MOTION_COMMAND[8];
+	uint8_t REG_EXTERNAL_CONTROL;
+	uint32_t REG_EXTERNAL_BAUD_RATE;
+	uint16_t REG_EXTERNAL_STATISTICS[5];
+	int32_t REG_ENCODER_VELOCITY;
 } AppRegs;
 
 /************************************************************************/
@@ -60,8 +93,8 @@ typedef struct
 /* Registers */
 #define ADD_REG_CONTROL                     32 // U8     Controls the device's modules.
 #define ADD_REG_PULSES                      33 // I32    Sends the number of pulses written in this register and set the direction according to the number's signal.
-#define ADD_REG_NOMINAL_PULSE_INTERVAL      34 // U16    Sets the motor's pulse interval when running at nominal speed.
-#define ADD_REG_INITIAL_PULSE_INTERVAL      35 // U16    Sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.
+#define ADD_REG_NOMINAL_PULSE_INTERVAL      34 // U32    Sets the motor's pulse interval when running at nominal speed.
+#define ADD_REG_INITIAL_PULSE_INTERVAL      35 // U32    Sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.
 #define ADD_REG_PULSE_STEP_INTERVAL         36 // U16    Sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
 #define ADD_REG_PULSE_PERIOD                37 // U16    Sets the period of the pulse.
 #define ADD_REG_ENCODER                     38 // I16    Contains the reading of the quadrature encoder.
@@ -69,6 +102,39 @@ typedef struct
 #define ADD_REG_STOP_SWITCH                 40 // U8     Contains the state of the stop switch.
 #define ADD_REG_MOVING                      41 // U8     Contains the state of the motor.
 #define ADD_REG_IMMEDIATE_PULSES            42 // I16    Sets immediately the motor's pulse interval. The value's signal defines the direction.
+#define ADD_REG_PROFILE_TYPE                43 // U8     Selects the motion profile used to accelerate and decelerate the motor.
+#define ADD_REG_ACCELERATION                44 // U32    Sets the acceleration of the S-curve and constant acceleration profiles, in steps/s^2.
+#define ADD_REG_JERK                        45 // U32    Sets the maximum jerk of the S-curve profile, in steps/s^3.
+#define ADD_REG_SEGMENTS                    46 // I32    Enqueues up to 4 motion segments, each one as a pair [steps, pulse interval].
+#define ADD_REG_SEGMENT_QUEUE_SPACE         47 // U8     Contains the number of free entries in the motion segments queue.
+#define ADD_REG_POSITION                    48 // I32    Contains the absolute position of the motor, in steps. Writing sets the current position.
+#define ADD_REG_MOVE_TO                     49 // I32    Moves the motor to the absolute position written in this register.
+#define ADD_REG_VELOCITY                    50 // I16    Sets the target velocity of the motor, in steps/s. The motor accelerates toward it with the configured acceleration.
+#define ADD_REG_CLOSED_LOOP                 51 // U8     Enables the closed loop correction of the motor position using the quadrature encoder.
+#define ADD_REG_STEPS_PER_COUNT             52 // I16    Sets the number of steps per encoder count, with 8 fractional bits.
+#define ADD_REG_CLOSED_LOOP_GAINS           53 // U16    Sets the proportional and integral gains of the closed loop, with 8 fractional bits.
+#define ADD_REG_POSITION_ERROR              54 // I32    Contains the number of steps missed and not yet corrected by the closed loop.
+#define ADD_REG_WAVEFORM_LENGTH             55 // U16    Sets the number of samples of the waveform and restarts its upload.
+#define ADD_REG_WAVEFORM_SAMPLES            56 // I16    Appends up to 32 velocity samples, in steps/s, to the waveform.
+#define ADD_REG_WAVEFORM_SAMPLE_INTERVAL    57 // U16    Sets the interval between waveform samples, in microseconds.
+#define ADD_REG_WAVEFORM_CONTROL            58 // U8     Starts and stops the waveform playback. An event is sent when the playback ends.
+#define ADD_REG_OSCILLATION_AMPLITUDE       59 // U16    Sets the peak velocity of the sinusoidal oscillation, in steps/s.
+#define ADD_REG_OSCILLATION_FREQUENCY       60 // U16    Sets the frequency of the sinusoidal oscillation, in mHz.
+#define ADD_REG_OSCILLATION_PHASE           61 // U16    Sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.
+#define ADD_REG_OSCILLATION_CYCLES          62 // U16    Sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.
+#define ADD_REG_STEP_GENERATOR              63 // U8     Selects how the pulses of the velocity, waveform and oscillation modes are generated.
+#define ADD_REG_HARDWARE_CRUISE             64 // U8     Enables counting the pulses of the cruise phase in hardware, without step interrupts.
+#define ADD_REG_ISR_STATISTICS              65 // U16    Contains the execution time and latency of the interrupts, in CPU cycles. Writing resets them.
+#define ADD_REG_TRACE_CONTROL               66 // U8     Enables the trace of the step periods of the ramped moves. Enabling clears the trace.
+#define ADD_REG_TRACE_STEPS                 67 // U32    Contains the number of steps traced. Only the last 256 are kept.
+#define ADD_REG_TRACE_INDEX                 68 // U16    Sets the first step read from TraceData, counted from the oldest step kept.
+#define ADD_REG_TRACE_DATA                  69 // U32    Contains 16 traced steps from TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, 16-18 the prescaler, 24 the deceleration.
+#define ADD_REG_SCHEDULED_START             70 // U32    Starts the next move or waveform at the Harp timestamp [seconds, microseconds]. Writing zeros cancels it.
+#define ADD_REG_MOTION_COMMAND              71 // I32    Sets all the motion parameters and moves [steps, nominal, initial, step interval, pulse period, profile, acceleration, jerk].
+#define ADD_REG_EXTERNAL_CONTROL            72 // U8     Selects the protocol of the external motor control on the serial input.
+#define ADD_REG_EXTERNAL_BAUD_RATE          73 // U32    Sets the baud rate of the external motor control, in bits/s.
+#define ADD_REG_EXTERNAL_STATISTICS         74 // U16    Contains the frames received, CRC errors, lost frames, rejected commands and ring overruns of the framed protocol. Writing resets them.
+#define ADD_REG_ENCODER_VELOCITY            75 // I32    Contains the velocity of the quadrature encoder, in counts/s with 8 fractional bits.
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -78,8 +144,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x2A
-#define APP_NBYTES_OF_REG_BANK              21
+#define APP_REGS_ADD_MAX                    0x4B
+#define APP_NBYTES_OF_REG_BANK              339
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -93,5 +159,22 @@ typedef struct
 #define B_RESET_QUAD_ENCODER               (1<<6)       // 
 #define B_STOP_SWITCH                      (1<<0)       // 
 #define B_IS_MOVING                        (1<<0)       // 
+#define B_ENABLE_CLOSED_LOOP               (1<<0)       // 
+#define B_START_WAVEFORM                   (1<<0)       // 
+#define B_STOP_WAVEFORM                    (1<<1)       // 
+#define B_LOOP_WAVEFORM                    (1<<2)       // 
+#define B_START_OSCILLATION                (1<<3)       // 
+#define B_ENABLE_HARDWARE_CRUISE           (1<<0)       // 
+#define B_ENABLE_TRACE                     (1<<0)       // 
+#define MSK_PROFILE_TYPE                   0x03         // 
+#define GM_PROFILE_LINEAR                  0            // 
+#define GM_PROFILE_S_CURVE                 1            // 
+#define GM_PROFILE_CONSTANT_ACCELERATION   2            // 
+#define MSK_STEP_GENERATOR                 0x01         // 
+#define GM_GENERATOR_PERIOD                0            // 
+#define GM_GENERATOR_DDS                   1            // 
+#define MSK_EXTERNAL_CONTROL               0x01         // 
+#define GM_EXTERNAL_LEGACY                 0            // 
+#define GM_EXTERNAL_FRAMED                 1            // 
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
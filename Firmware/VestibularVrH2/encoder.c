@@ -17,6 +17,10 @@ void init_quadrature_encoder (void)
 
 	/* Start timer */
 	TCD1_CTRLA = TC_CLKSEL_DIV1_gc;
+
+	/* Interrupt on the edges of phase A to time them */
+	PORTC_INTCTRL = (PORTC_INTCTRL & ~PORT_INT0LVL_gm) | PORT_INT0LVL_LO_gc;
+	reset_encoder_velocity();
 }
 
 int16_t get_quadrature_encoder (void)
@@ -36,4 +40,149 @@ int16_t get_quadrature_encoder (void)
 void reset_quadrature_encoder (void)
 {
 	TCD1_CNT = 0x8000;
+
+	reset_encoder_velocity();
+}
+
+/************************************************************************/
+/* Velocity                                                             */
+/************************************************************************/
+/* At high speed the velocity is the count difference over the last     */
+/* ENCODER_VELOCITY_WINDOW ms. At low speed that difference is mostly   */
+/* quantization, so the pin interrupt timestamps the edges of phase A   */
+/* and the velocity is the counts between two edges over their time.    */
+/* The interrupt is only enabled at low speed. In counts/s with 8       */
+/* fractional bits.                                                     */
+/*                                                                      */
+/* The edges are timed with the Harp timestamp, 32 us, when the low     */
+/* level interrupt runs. No timer is left to capture them: TCC0 sends   */
+/* the pulses, TCC1 is the timestamp of the core, TCD0 belongs to the   */
+/* external control and the expander PWM, TCD1 decodes the encoder and  */
+/* TCE0 counts the steps. So the two edges are at least                 */
+/* ENCODER_EDGE_MIN_INTERVAL apart, keeping the error of the tick       */
+/* within 1%, and the edges between them are only counted.             */
+int16_t encoder_window[ENCODER_VELOCITY_WINDOW];
+uint8_t encoder_window_head;
+
+int16_t encoder_edge_count;
+uint32_t encoder_edge_time;
+uint8_t encoder_edges;
+
+bool encoder_edge_mode;
+bool encoder_reference;
+int16_t encoder_reference_count;
+uint32_t encoder_reference_time;
+uint8_t encoder_reference_edges;
+uint32_t encoder_interval;
+int32_t encoder_velocity;
+
+static void set_encoder_edge_mode (bool enable)
+{
+	encoder_edge_mode = enable;
+	encoder_reference = false;
+	encoder_reference_edges = encoder_edges;
+	encoder_interval = 0;
+
+	PORTC_INT0MASK = (enable) ? (1 << 4) : 0;
+}
+
+void capture_encoder_edge (uint32_t time)
+{
+	encoder_edge_count = TCD1_CNT;
+	encoder_edge_time = time;
+	encoder_edges++;
+}
+
+void reset_encoder_velocity (void)
+{
+	for (uint8_t i = 0; i < ENCODER_VELOCITY_WINDOW; i++)
+	{
+		encoder_window[i] = TCD1_CNT;
+	}
+
+	encoder_velocity = 0;
+	set_encoder_edge_mode(true);
+}
+
+static bool update_edge_velocity (uint32_t time)
+{
+	int16_t counts;
+	uint32_t interval;
+	int32_t bound;
+
+	/* A new edge since the last update */
+	if (encoder_edges != encoder_reference_edges)
+	{
+		encoder_reference_edges = encoder_edges;
+
+		counts = encoder_edge_count - encoder_reference_count;
+		interval = encoder_edge_time - encoder_reference_time;
+
+		/* Too close to the reference to be timed within 1%, wait for more edges */
+		if (encoder_reference && interval < ENCODER_EDGE_MIN_INTERVAL)
+			return encoder_interval != 0;
+
+		if (encoder_reference)
+		{
+			/* Too many counts to be a low speed */
+			if (counts > 255 || counts < -255)
+				return false;
+
+			encoder_velocity = (int32_t)counts * (ENCODER_TICK_RATE * 256L) / (int32_t)interval;
+			encoder_interval = interval;
+		}
+
+		encoder_reference = true;
+		encoder_reference_count = encoder_edge_count;
+		encoder_reference_time = encoder_edge_time;
+
+		return encoder_interval != 0;
+	}
+
+	if (encoder_reference == false || encoder_interval == 0)
+		return false;
+
+	/* The edges after the reference were counted but not timed */
+	interval = time - encoder_edge_time;
+
+	if (interval > ENCODER_VELOCITY_TIMEOUT)
+	{
+		encoder_velocity = 0;
+	}
+	else if (interval > ENCODER_EDGE_MIN_INTERVAL)
+	{
+		/* No edge for that long, the motor is slower than one edge over that time */
+		bound = ENCODER_COUNTS_PER_EDGE * (ENCODER_TICK_RATE * 256L) / (int32_t)interval;
+
+		if (encoder_velocity > bound)
+			encoder_velocity = bound;
+		else if (encoder_velocity < -bound)
+			encoder_velocity = -bound;
+	}
+
+	return true;
+}
+
+int32_t update_encoder_velocity (uint32_t time)
+{
+	int16_t count = TCD1_CNT;
+	int16_t window_counts = count - encoder_window[encoder_window_head];
+	uint16_t window_speed = (window_counts < 0) ? -window_counts : window_counts;
+
+	encoder_window[encoder_window_head] = count;
+	encoder_window_head = (encoder_window_head + 1) & (ENCODER_VELOCITY_WINDOW - 1);
+
+	/* Change between the two methods with some hysteresis */
+	if (encoder_edge_mode && window_speed > ENCODER_EDGE_MODE_MAX)
+		set_encoder_edge_mode(false);
+	else if (!encoder_edge_mode && window_speed < ENCODER_EDGE_MODE_MIN)
+		set_encoder_edge_mode(true);
+
+	/* The count difference until two edges are timed */
+	if (encoder_edge_mode == false || update_edge_velocity(time) == false)
+	{
+		encoder_velocity = (int32_t)window_counts * (256000L / ENCODER_VELOCITY_WINDOW);
+	}
+
+	return encoder_velocity;
 }
\ No newline at end of file
@@ -11,8 +11,20 @@
 	#define false 0
 #endif
 
+#define ENCODER_TICK_RATE 31250			// Harp timestamp ticks per second
+#define ENCODER_VELOCITY_WINDOW 8		// ms, must be a power of 2
+#define ENCODER_EDGE_MODE_MIN 32		// Counts per window below which the edges are timed
+#define ENCODER_EDGE_MODE_MAX 64		// Counts per window above which the edges are not timed
+#define ENCODER_COUNTS_PER_EDGE 2		// Both edges of phase A
+#define ENCODER_EDGE_MIN_INTERVAL 125	// 4 ms between the timed edges, within 1% of the 32 us ticks
+#define ENCODER_VELOCITY_TIMEOUT 62500	// 2 s without edges is stopped
+
 void init_quadrature_encoder (void);
 int16_t get_quadrature_encoder (void);
 void reset_quadrature_encoder (void);
 
+void capture_encoder_edge (uint32_t time);
+int32_t update_encoder_velocity (uint32_t time);
+void reset_encoder_velocity (void);
+
 #endif /* _ENCODER_H_ */
\ No newline at end of file
@@ -0,0 +1,316 @@
+#include "external_control.h"
+#include "cpu.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+#include "stepper_motor.h"
+#include <util/crc16.h>
+
+/************************************************************************/
+/* Serial port                                                          */
+/************************************************************************/
+/* USARTD0 only receives. The legacy protocol takes each byte in its    */
+/* interrupt, see interrupts.c. The framed protocol receives through    */
+/* DMA channel 3 into a ring buffer, and TCD0 polls it every 100 us.    */
+/* The instrumented builds keep TCD0 running free at the CPU clock, so  */
+/* the period is then a compare A moved on at each interrupt.           */
+extern bool external_control_first_byte;
+
+bool external_control_framed = false;
+uint16_t external_timer_cycles;
+
+void start_external_timer (uint16_t cycles)
+{
+#ifdef ISR_INSTRUMENTATION
+	external_timer_cycles = cycles;
+	TCD0_CCA = TCD0_CNT + cycles;
+	TCD0_INTFLAGS = TC0_CCAIF_bm;
+	TCD0_INTCTRLB = INT_LEVEL_LOW;
+#else
+	timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV8, cycles >> 3, INT_LEVEL_LOW);
+#endif
+}
+
+void next_external_timer_period (void)
+{
+#ifdef ISR_INSTRUMENTATION
+	TCD0_CCA += external_timer_cycles;
+#endif
+}
+
+void stop_external_timer (void)
+{
+#ifdef ISR_INSTRUMENTATION
+	TCD0_INTCTRLB = INT_LEVEL_OFF;
+#else
+	timer_type0_stop(&TCD0);
+#endif
+}
+
+void init_external_control (void)
+{
+	USARTD0_CTRLC = USART_CMODE_ASYNCHRONOUS_gc | USART_PMODE_DISABLED_gc | USART_CHSIZE_8BIT_gc;
+	USARTD0_CTRLB = USART_RXEN_bm | USART_CLK2X_bm;
+	
+	set_external_baud_rate(100000);
+	start_external_control(GM_EXTERNAL_LEGACY);
+}
+
+bool set_external_baud_rate (uint32_t baud_rate)
+{
+	/* With CLK2X and BSCALE = 0 the baud rate is 32 MHz / (8 * (BSEL + 1)) */
+	uint32_t divider;
+	uint32_t actual;
+	
+	if (baud_rate == 0)
+		return false;
+	
+	divider = (4000000UL + baud_rate / 2) / baud_rate;
+	
+	if (divider < 1 || divider > 4096)
+		return false;
+	
+	/* Reject the baud rates more than 2 % away */
+	actual = 4000000UL / divider;
+	
+	if (((actual > baud_rate) ? actual - baud_rate : baud_rate - actual) * 50 > baud_rate)
+		return false;
+	
+	divider--;
+	
+	USARTD0_BAUDCTRLA = divider & 0xFF;
+	USARTD0_BAUDCTRLB = (divider >> 8) & 0x0F;
+	
+	return true;
+}
+
+/************************************************************************/
+/* Framed protocol                                                      */
+/************************************************************************/
+uint8_t external_ring[EXTERNAL_RING_SIZE];
+uint8_t external_ring_tail;
+
+uint8_t external_frame[EXTERNAL_FRAME_SIZE];
+uint8_t external_frame_length;
+
+bool external_sequence_started;
+uint8_t external_sequence;
+uint32_t external_acceleration;
+
+uint16_t external_statistics[EXTERNAL_STATISTICS_LENGTH];
+
+void start_external_control (uint8_t protocol)
+{
+	/* Stop the current protocol */
+	USARTD0_CTRLA &= ~USART_RXCINTLVL_gm;
+	DMA_CH3_CTRLA = 0;
+	stop_external_timer();
+	
+	external_control_framed = (protocol == GM_EXTERNAL_FRAMED);
+	
+	if (external_control_framed)
+	{
+		external_ring_tail = 0;
+		external_frame_length = 0;
+		DMA_INTFLAGS = DMA_CH3TRNIF_bm;
+		external_sequence_started = false;
+		external_acceleration = 0;
+		
+		/* Each received byte is written to the ring, which wraps at the end of the block */
+		DMA_CTRL |= DMA_ENABLE_bm;
+		DMA_CH3_ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_FIXED_gc | DMA_CH_DESTRELOAD_BLOCK_gc | DMA_CH_DESTDIR_INC_gc;
+		DMA_CH3_TRIGSRC = DMA_CH_TRIGSRC_USARTD0_RXC_gc;
+		DMA_CH3_TRFCNT = EXTERNAL_RING_SIZE;
+		DMA_CH3_REPCNT = 0;			// Repeats forever
+		
+		DMA_CH3_SRCADDR0 = (uint8_t)((uintptr_t)&USARTD0_DATA);
+		DMA_CH3_SRCADDR1 = (uint8_t)((uintptr_t)&USARTD0_DATA >> 8);
+		DMA_CH3_SRCADDR2 = 0;
+		DMA_CH3_DESTADDR0 = (uint8_t)((uintptr_t)external_ring);
+		DMA_CH3_DESTADDR1 = (uint8_t)((uintptr_t)external_ring >> 8);
+		DMA_CH3_DESTADDR2 = 0;
+		
+		DMA_CH3_CTRLA = DMA_CH_ENABLE_bm | DMA_CH_REPEAT_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+		
+		start_external_timer(EXTERNAL_POLL_PERIOD);
+	}
+	else
+	{
+		external_control_first_byte = true;
+		
+		USARTD0_CTRLA |= (INT_LEVEL_LOW << 4);
+	}
+}
+
+bool get_external_control_framed (void)
+{
+	return external_control_framed;
+}
+
+static bool run_external_command (uint8_t command, int32_t value)
+{
+	int16_t reg;
+	
+	switch (command)
+	{
+		case EXTERNAL_COMMAND_PERIOD:
+			if (value < INT16_MIN || value > INT16_MAX)
+				return false;
+			
+			reg = value;
+			return app_write_REG_IMMEDIATE_PULSES(&reg);
+		
+		case EXTERNAL_COMMAND_VELOCITY:
+			if (value < INT16_MIN || value > INT16_MAX)
+				return false;
+			
+			reg = value;
+			
+			if (app_write_REG_VELOCITY(&reg) == false)
+				return false;
+			
+			/* A velocity move starts with the Acceleration register */
+			if (external_acceleration)
+				set_velocity_acceleration(external_acceleration);
+			
+			return true;
+		
+		case EXTERNAL_COMMAND_ACCELERATION:
+			if (value < 10 || value > 1000000)
+				return false;
+			
+			external_acceleration = value;
+			set_velocity_acceleration(external_acceleration);
+			
+			return true;
+		
+		default:
+			return false;
+	}
+}
+
+static bool take_external_frame (void)
+{
+	uint16_t crc = 0xFFFF;
+	int32_t value;
+	
+	for (uint8_t i = 0; i < EXTERNAL_FRAME_SIZE - 2; i++)
+	{
+		crc = _crc_xmodem_update(crc, external_frame[i]);
+	}
+	
+	if (crc != (external_frame[7] | ((uint16_t)external_frame[8] << 8)))
+	{
+		external_statistics[EXTERNAL_STATISTICS_CRC_ERRORS]++;
+		return false;
+	}
+	
+	/* A repeated frame is only run once */
+	if (external_sequence_started)
+	{
+		if (external_frame[1] == external_sequence)
+			return true;
+		
+		external_statistics[EXTERNAL_STATISTICS_LOST_FRAMES] += (uint8_t)(external_frame[1] - external_sequence - 1);
+	}
+	
+	external_sequence_started = true;
+	external_sequence = external_frame[1];
+	external_statistics[EXTERNAL_STATISTICS_FRAMES]++;
+	
+	value  = (uint32_t)external_frame[3];
+	value |= (uint32_t)external_frame[4] << 8;
+	value |= (uint32_t)external_frame[5] << 16;
+	value |= (uint32_t)external_frame[6] << 24;
+	
+	if (run_external_command(external_frame[2], value) == false)
+		external_statistics[EXTERNAL_STATISTICS_REJECTED]++;
+	
+	return true;
+}
+
+static void resync_external_frame (void)
+{
+	/* Look for the next sync byte in what was received so far */
+	uint8_t start;
+	
+	for (start = 1; start < external_frame_length; start++)
+	{
+		if (external_frame[start] == EXTERNAL_FRAME_SYNC)
+			break;
+	}
+	
+	for (uint8_t i = start; i < external_frame_length; i++)
+	{
+		external_frame[i - start] = external_frame[i];
+	}
+	
+	external_frame_length -= start;
+}
+
+void poll_external_control (void)
+{
+	uint8_t wrapped;
+	uint8_t head;
+	
+	/* The DMA counts the bytes left until the end of the ring and sets */
+	/* its transaction flag each time it wraps. Both are read again     */
+	/* when the ring wraps in between.                                  */
+	do
+	{
+		wrapped = DMA_INTFLAGS & DMA_CH3TRNIF_bm;
+		head = (EXTERNAL_RING_SIZE - DMA_CH3_TRFCNTL) & (EXTERNAL_RING_SIZE - 1);
+	} while (wrapped != (DMA_INTFLAGS & DMA_CH3TRNIF_bm));
+	
+	if (wrapped)
+	{
+		DMA_INTFLAGS = DMA_CH3TRNIF_bm;
+		
+		/* Wrapped up to or past the tail, the whole ring was written   */
+		/* over. Its bytes and the partial frame are dropped, the next  */
+		/* sync byte starts again.                                      */
+		if (head >= external_ring_tail)
+		{
+			external_statistics[EXTERNAL_STATISTICS_OVERRUNS]++;
+			external_ring_tail = head;
+			external_frame_length = 0;
+			return;
+		}
+	}
+	
+	while (external_ring_tail != head)
+	{
+		uint8_t byte = external_ring[external_ring_tail];
+		
+		external_ring_tail = (external_ring_tail + 1) & (EXTERNAL_RING_SIZE - 1);
+		
+		/* Skip the bytes until a frame starts */
+		if (external_frame_length == 0 && byte != EXTERNAL_FRAME_SYNC)
+			continue;
+		
+		external_frame[external_frame_length++] = byte;
+		
+		while (external_frame_length == EXTERNAL_FRAME_SIZE)
+		{
+			if (take_external_frame())
+				external_frame_length = 0;
+			else
+				resync_external_frame();
+		}
+	}
+}
+
+void get_external_statistics (uint16_t *statistics)
+{
+	for (uint8_t i = 0; i < EXTERNAL_STATISTICS_LENGTH; i++)
+	{
+		statistics[i] = external_statistics[i];
+	}
+}
+
+void reset_external_statistics (void)
+{
+	for (uint8_t i = 0; i < EXTERNAL_STATISTICS_LENGTH; i++)
+	{
+		external_statistics[i] = 0;
+	}
+}
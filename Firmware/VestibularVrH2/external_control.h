@@ -0,0 +1,54 @@
+#ifndef _EXTERNAL_CONTROL_H_
+#define _EXTERNAL_CONTROL_H_
+#include <avr/io.h>
+#include "instrumentation.h"
+
+// Define if not defined
+#ifndef bool
+	#define bool uint8_t
+#endif
+#ifndef true
+	#define true 1
+	#define false 0
+#endif
+
+/* Framed protocol, 9 bytes in little endian */
+/* [sync, sequence, command, value (4 bytes), CRC-16 (2 bytes)]            */
+/* The CRC-16 is CCITT (0x1021), starting at 0xFFFF, over the first 7 bytes */
+#define EXTERNAL_FRAME_SIZE 9
+#define EXTERNAL_FRAME_SYNC 0xA5
+
+#define EXTERNAL_COMMAND_PERIOD 1		// Pulse interval in microseconds, like ImmediatePulses
+#define EXTERNAL_COMMAND_VELOCITY 2		// Velocity in steps/s, like Velocity
+#define EXTERNAL_COMMAND_ACCELERATION 3	// Acceleration of the velocity changes in steps/s^2
+
+#define EXTERNAL_RING_SIZE 64			// Must be a power of 2
+#define EXTERNAL_POLL_PERIOD 3200		// 100 us, in CPU cycles
+#define EXTERNAL_BYTE_TIMEOUT 6400		// 200 us between the two bytes of the legacy protocol
+
+/* TCD0 runs free in the instrumented builds, see instrumentation.h */
+#ifdef ISR_INSTRUMENTATION
+	#define EXTERNAL_TIMER_vect TCD0_CCA_vect
+#else
+	#define EXTERNAL_TIMER_vect TCD0_OVF_vect
+#endif
+
+#define EXTERNAL_STATISTICS_FRAMES 0
+#define EXTERNAL_STATISTICS_CRC_ERRORS 1
+#define EXTERNAL_STATISTICS_LOST_FRAMES 2
+#define EXTERNAL_STATISTICS_REJECTED 3
+#define EXTERNAL_STATISTICS_OVERRUNS 4	// Ring written over before it was read
+#define EXTERNAL_STATISTICS_LENGTH 5
+
+void init_external_control (void);
+bool set_external_baud_rate (uint32_t baud_rate);
+void start_external_control (uint8_t protocol);
+bool get_external_control_framed (void);
+void start_external_timer (uint16_t cycles);
+void next_external_timer_period (void);
+void stop_external_timer (void);
+void poll_external_control (void);
+void get_external_statistics (uint16_t *statistics);
+void reset_external_statistics (void);
+
+#endif /* _EXTERNAL_CONTROL_H_ */
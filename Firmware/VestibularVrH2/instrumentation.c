@@ -0,0 +1,185 @@
+#include "instrumentation.h"
+
+/* Execution times are measured with TCD0, free running at the CPU clock. */
+/* The latencies of the step interrupts come from the counter of the     */
+/* step timer, converted to CPU cycles from its prescaler. The other     */
+/* interrupts have their event captured by TCD0 through the event system: */
+/* the stop switch on CCB, the end of the ADC conversion on CCC and the   */
+/* start bit of the serial port on CCD. A capture keeps the first event   */
+/* since it was read, the later ones wait in its buffer or are lost.      */
+#ifdef ISR_INSTRUMENTATION
+static const uint8_t clock_select_shift[] = {0, 0, 1, 2, 3, 6, 8, 10};
+
+uint16_t isr_min_cycles[ISR_INSTRUMENTED];
+uint16_t isr_max_cycles[ISR_INSTRUMENTED];
+uint32_t isr_sum_cycles[ISR_INSTRUMENTED];
+uint16_t isr_samples[ISR_INSTRUMENTED];
+uint16_t isr_max_latency[ISR_INSTRUMENTED];
+uint16_t step_period_error;
+
+void init_isr_instrumentation (void)
+{
+	EVSYS_CH5MUX = EVSYS_CHMUX_PORTB_PIN0_gc;		// Stop switch, both edges
+	EVSYS_CH6MUX = EVSYS_CHMUX_ADCA_CH0_gc;
+	EVSYS_CH7MUX = EVSYS_CHMUX_PORTD_PIN2_gc;		// USARTD0 RX
+	
+	/* Only the falling edges of the serial line, the first one is the start bit */
+	PORTD_PIN2CTRL = (PORTD_PIN2CTRL & ~PORT_ISC_gm) | PORT_ISC_FALLING_gc;
+	
+	/* The channel 4 of CCA is unused, CCA stays a compare */
+	TCD0_CTRLA = TC_CLKSEL_OFF_gc;
+	TCD0_CTRLFSET = TC_CMD_RESET_gc;
+	TCD0_PER = 0xFFFF;
+	TCD0_CTRLB = TC0_CCBEN_bm | TC0_CCCEN_bm | TC0_CCDEN_bm;
+	TCD0_CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH4_gc;
+	TCD0_CTRLA = TC_CLKSEL_DIV1_gc;
+}
+
+static uint16_t ticks_to_cycles (uint32_t ticks, uint8_t clock_select)
+{
+	uint32_t cycles;
+	
+	/* Timers clocked by events don't have a time base */
+	if (clock_select > 7)
+		return 0;
+	
+	cycles = ticks << clock_select_shift[clock_select];
+	
+	return (cycles > 0xFFFF) ? 0xFFFF : cycles;
+}
+
+void isr_instrumentation_exit (uint8_t isr, uint16_t entry_time)
+{
+	/* TCD0 wraps around every 2 ms, longer than any interrupt */
+	uint16_t cycles = TCD0_CNT - entry_time;
+	
+	if (isr_samples[isr] == 0 || cycles < isr_min_cycles[isr])
+		isr_min_cycles[isr] = cycles;
+	
+	if (cycles > isr_max_cycles[isr])
+		isr_max_cycles[isr] = cycles;
+	
+	/* Halve the sum to keep the mean of the recent interrupts without overflows */
+	if (isr_samples[isr] == 0x8000)
+	{
+		isr_samples[isr] >>= 1;
+		isr_sum_cycles[isr] >>= 1;
+	}
+	
+	isr_sum_cycles[isr] += cycles;
+	isr_samples[isr]++;
+}
+
+void isr_instrumentation_latency (uint8_t isr, uint16_t ticks, uint8_t clock_select)
+{
+	uint16_t cycles = ticks_to_cycles(ticks, clock_select & TC0_CLKSEL_gm);
+	
+	if (cycles > isr_max_latency[isr])
+		isr_max_latency[isr] = cycles;
+}
+
+static bool read_capture (register16_t *capture, uint8_t flag, uint16_t *time)
+{
+	if ((TCD0_INTFLAGS & flag) == 0)
+		return false;
+	
+	*time = *capture;
+	
+	/* Drop the events that followed, the next capture is a new event */
+	while (TCD0_INTFLAGS & flag)
+	{
+		(void)*capture;
+	}
+	
+	TCD0_INTFLAGS = TC0_ERRIF_bm;
+	
+	return true;
+}
+
+void isr_instrumentation_event_latency (uint8_t isr, uint16_t entry_time)
+{
+	uint16_t event_time;
+	uint16_t bsel;
+	
+	switch (isr)
+	{
+		case ISR_PORTB_INT0:
+			if (!read_capture(&TCD0.CCB, TC0_CCBIF_bm, &event_time))
+				return;
+			break;
+		
+		case ISR_ADCA_CH0:
+			if (!read_capture(&TCD0.CCC, TC0_CCCIF_bm, &event_time))
+				return;
+			break;
+		
+		case ISR_USARTD0_RXC:
+			if (!read_capture(&TCD0.CCD, TC0_CCDIF_bm, &event_time))
+				return;
+			
+			/* The byte is received in the middle of the stop bit, 9.5 bits */
+			/* after the start, and a bit lasts 8 * (BSEL + 1) with CLK2X   */
+			bsel = ((uint16_t)(USARTD0_BAUDCTRLB & 0x0F) << 8) | USARTD0_BAUDCTRLA;
+			event_time += (bsel + 1) * 76;
+			break;
+		
+		default:
+			return;
+	}
+	
+	isr_instrumentation_latency(isr, entry_time - event_time, TC_CLKSEL_DIV1_gc);
+}
+
+void isr_instrumentation_step_period (uint16_t count, uint16_t period, uint8_t clock_select)
+{
+	uint16_t cycles;
+	
+	/* The new period was written after the counter went past it */
+	if (count <= period)
+		return;
+	
+	cycles = ticks_to_cycles(count - period, clock_select & TC0_CLKSEL_gm);
+	
+	if (cycles > step_period_error)
+		step_period_error = cycles;
+}
+
+void reset_isr_statistics (void)
+{
+	for (uint8_t i = 0; i < ISR_INSTRUMENTED; i++)
+	{
+		isr_min_cycles[i] = 0;
+		isr_max_cycles[i] = 0;
+		isr_sum_cycles[i] = 0;
+		isr_samples[i] = 0;
+		isr_max_latency[i] = 0;
+	}
+	
+	step_period_error = 0;
+}
+
+void get_isr_statistics (uint16_t *statistics)
+{
+	for (uint8_t i = 0; i < ISR_INSTRUMENTED; i++)
+	{
+		statistics[i * 4 + 0] = isr_min_cycles[i];
+		statistics[i * 4 + 1] = (isr_samples[i]) ? isr_sum_cycles[i] / isr_samples[i] : 0;
+		statistics[i * 4 + 2] = isr_max_cycles[i];
+		statistics[i * 4 + 3] = isr_max_latency[i];
+	}
+	
+	statistics[ISR_INSTRUMENTED * 4] = step_period_error;
+}
+#else
+void init_isr_instrumentation (void) {}
+void reset_isr_statistics (void) {}
+
+void get_isr_statistics (uint16_t *statistics)
+{
+	/* Not measured in this build */
+	for (uint8_t i = 0; i < ISR_STATISTICS_LENGTH; i++)
+	{
+		statistics[i] = 0;
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef _INSTRUMENTATION_H_
+#define _INSTRUMENTATION_H_
+#include <avr/io.h>
+
+// Define if not defined
+#ifndef bool
+	#define bool uint8_t
+#endif
+#ifndef true
+	#define true 1
+	#define false 0
+#endif
+
+/* Uncomment to measure the interrupts, adds a few microseconds to each one */
+/* TCD0 then runs free at the CPU clock for the measurements, and the        */
+/* external control times its poll with the compare A of TCD0 instead       */
+//#define ISR_INSTRUMENTATION
+
+#define ISR_TCC0_OVF 0
+#define ISR_TCC0_CCA 1
+#define ISR_ADCA_CH0 2
+#define ISR_USARTD0_RXC 3
+#define ISR_PORTB_INT0 4
+#define ISR_INSTRUMENTED 5
+
+/* For each interrupt, min, mean and max execution and max latency in cycles, then the worst step period error */
+#define ISR_STATISTICS_LENGTH (ISR_INSTRUMENTED * 4 + 1)
+
+/* The temporary register of TCD0 is kept for the 16 bits accesses of the */
+/* interrupted code. ISR_LATENCY takes the ticks of the step timer, and    */
+/* ISR_EVENT_LATENCY the time TCD0 captured the event of the interrupt.  */
+#ifdef ISR_INSTRUMENTATION
+	#define ISR_ENTER(isr) uint8_t isr_timer_temp = TCD0_TEMP; uint16_t isr_entry_time = TCD0_CNT
+	#define ISR_EXIT(isr) isr_instrumentation_exit(isr, isr_entry_time); TCD0_TEMP = isr_timer_temp
+	#define ISR_LATENCY(isr, ticks) isr_instrumentation_latency(isr, ticks, TCC0_CTRLA)
+	#define ISR_EVENT_LATENCY(isr) isr_instrumentation_event_latency(isr, isr_entry_time)
+	#define ISR_STEP_PERIOD_CHECK() isr_instrumentation_step_period(TCC0_CNT, TCC0_PER, TCC0_CTRLA)
+#else
+	#define ISR_ENTER(isr)
+	#define ISR_EXIT(isr)
+	#define ISR_LATENCY(isr, ticks)
+	#define ISR_EVENT_LATENCY(isr)
+	#define ISR_STEP_PERIOD_CHECK()
+#endif
+
+void init_isr_instrumentation (void);
+void isr_instrumentation_exit (uint8_t isr, uint16_t entry_time);
+void isr_instrumentation_latency (uint8_t isr, uint16_t ticks, uint8_t clock_select);
+void isr_instrumentation_event_latency (uint8_t isr, uint16_t entry_time);
+void isr_instrumentation_step_period (uint16_t count, uint16_t period, uint8_t clock_select);
+void reset_isr_statistics (void);
+void get_isr_statistics (uint16_t *statistics);
+
+#endif /* _INSTRUMENTATION_H_ */
\ No newline at end of file
@@ -5,6 +5,10 @@
 #include "hwbp_core.h"
 
 #include "analog_input.h"
+#include "encoder.h"
+#include "stepper_motor.h"
+#include "external_control.h"
+#include "instrumentation.h"
 
 /************************************************************************/
 /* Declare application registers                                        */
@@ -31,10 +35,11 @@ extern AppRegs app_regs;
 /************************************************************************/
 /* STOP                                                                 */
 /************************************************************************/
-extern bool motor_is_running;
-
-ISR(PORTB_INT0_vect, ISR_NAKED)
+ISR(PORTB_INT0_vect)
 {
+	ISR_ENTER(ISR_PORTB_INT0);
+	ISR_EVENT_LATENCY(ISR_PORTB_INT0);
+	
 	if (read_STOP_SWITCH)
 	{
 		/* Update register and send event */
@@ -43,9 +48,8 @@ ISR(PORTB_INT0_vect, ISR_NAKED)
 	}
 	else
 	{		
-		/* Stop motor */
-		timer_type0_stop(&TCC0);
-		motor_is_running = false;
+		/* Stop motor and discard pending segments */
+		stop_rotation();
 		
 		/* Disable motor */
 		set_MOTOR_ENABLE;
@@ -55,18 +59,30 @@ ISR(PORTB_INT0_vect, ISR_NAKED)
 		core_func_send_event(ADD_REG_STOP_SWITCH, true);
 	}
 	
-	reti();
+	ISR_EXIT(ISR_PORTB_INT0);
 }
 
 /************************************************************************/
 /* ADC                                                                  */
 /************************************************************************/
-ISR(ADCA_CH0_vect, ISR_NAKED)
+ISR(ADCA_CH0_vect)
 {
+	ISR_ENTER(ISR_ADCA_CH0);
+	ISR_EVENT_LATENCY(ISR_ADCA_CH0);
+	
 	app_regs.REG_ANALOG_INPUT = get_analog_input();
 	core_func_send_event(ADD_REG_ANALOG_INPUT, false);
 	
-	reti();
+	ISR_EXIT(ISR_ADCA_CH0);
+}
+
+/************************************************************************/
+/* ENCODER                                                              */
+/************************************************************************/
+ISR(PORTC_INT0_vect/*, ISR_NAKED*/)
+{
+	/* Time the edges of phase A at low speed */
+	capture_encoder_edge(get_harp_ticks());
 }
 
 /************************************************************************/
@@ -75,15 +91,18 @@ ISR(ADCA_CH0_vect, ISR_NAKED)
 bool external_control_first_byte = true;
 int16_t motor_pulse_interval;
 
-ISR(USARTD0_RXC_vect, ISR_NAKED)
+ISR(USARTD0_RXC_vect)
 {
+	ISR_ENTER(ISR_USARTD0_RXC);
+	ISR_EVENT_LATENCY(ISR_USARTD0_RXC);
+	
 	if (external_control_first_byte)
 	{
 		external_control_first_byte = false;
 		
 		motor_pulse_interval = USARTD0_DATA;
 		
-		timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV64, 100, INT_LEVEL_LOW);	// 200 us
+		start_external_timer(EXTERNAL_BYTE_TIMEOUT);
 	}
 	else
 	{
@@ -93,7 +112,7 @@ ISR(USARTD0_RXC_vect, ISR_NAKED)
 		
 		motor_pulse_interval |= (temp << 8) & 0xFF00;
 		
-		timer_type0_stop(&TCD0);
+		stop_external_timer();
 		
 		app_regs.REG_ANALOG_INPUT = motor_pulse_interval;
 		core_func_send_event(ADD_REG_ANALOG_INPUT, true);
@@ -101,15 +120,21 @@ ISR(USARTD0_RXC_vect, ISR_NAKED)
 		app_write_REG_IMMEDIATE_PULSES(&motor_pulse_interval);
 	}
 	
-	reti();
+	ISR_EXIT(ISR_USARTD0_RXC);
 }
 
 
-ISR(TCD0_OVF_vect, ISR_NAKED)
+ISR(EXTERNAL_TIMER_vect/*, ISR_NAKED*/)
 {
-	external_control_first_byte = true;
+	/* The framed protocol polls its DMA buffer */
+	if (get_external_control_framed())
+	{
+		next_external_timer_period();
+		poll_external_control();
+		return;
+	}
 	
-	timer_type0_stop(&TCD0);
+	external_control_first_byte = true;
 	
-	reti();
+	stop_external_timer();
 }
\ No newline at end of file
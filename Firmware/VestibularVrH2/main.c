@@ -2,6 +2,7 @@
 
 #include "app.h"
 #include "app_ios_and_regs.h"
+#include "stepper_motor.h"
 
 int main(void)
 {
@@ -11,7 +12,10 @@ int main(void)
 	/* Enable interrupts */
 	hwbp_app_enable_interrupts;
 	
-	/* Infinite loop */
-	while(1);
+	/* Infinite loop, the ramp tables are built here between the interrupts */
+	while(1)
+	{
+		build_pending_ramp_table();
 		//__asm volatile("sleep");
+	}
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include "stepper_motor.h"
 #include "app_ios_and_regs.h"
+#include "instrumentation.h"
+#include "hwbp_core.h"
+#include <math.h>
+#include <avr/pgmspace.h>
 
 /************************************************************************/
 /* Global Parameters                                                    */
@@ -7,61 +11,1954 @@
 extern AppRegs app_regs;
 
 uint16_t m_pulse_period_us;
-uint16_t m_min_pulse_interval_us;
-uint16_t m_max_pulse_interval_us;
+uint32_t m_min_pulse_interval_us;
+uint32_t m_max_pulse_interval_us;
 uint16_t m_pulse_step_interval_us;
 
-int16_t ramp_steps;
+uint8_t m_profile_type;
+uint32_t m_acceleration;
+uint32_t m_jerk;
+
+uint16_t ramp_steps;
+uint16_t ramp_cruise;
+
+/************************************************************************/
+/* Ramp timing                                                          */
+/************************************************************************/
+/* The ramped moves use the smallest TCC0 prescaler that still fits the */
+/* initial pulse interval, the longest of the move, in 16 bits. Faster  */
+/* moves get a finer resolution and slow moves can last up to ~2 s.     */
+/* The nominal interval, the shortest, must still span RAMP_MIN_TICKS   */
+/* ticks of that prescaler, so the registers refuse the intervals that  */
+/* don't fit both ends, see check_ramp_intervals().                     */
+static const uint8_t prescaler_shift[] = {0, 1, 2, 3, 6, 8, 10};
+
+static uint8_t prescaler_index (uint32_t time_us)
+{
+	uint8_t i;
+	
+	for (i = 0; i < sizeof(prescaler_shift) - 1; i++)
+	{
+		if (((time_us << 5) >> prescaler_shift[i]) <= 0xFFFF)
+			break;
+	}
+	
+	return i;
+}
+
+bool check_ramp_intervals (uint32_t nominal_us, uint32_t initial_us)
+{
+	uint8_t shift = prescaler_shift[prescaler_index(initial_us)];
+	
+	return ((nominal_us << 5) >> shift) >= RAMP_MIN_TICKS;
+}
+
+uint8_t ramp_prescaler;
+uint8_t ramp_prescaler_shift;
+uint16_t ramp_pulse_width;
+
+/* Timing of the ramp being built */
+uint8_t staged_prescaler;
+uint8_t staged_prescaler_shift;
+uint16_t staged_pulse_width;
+float ramp_tick_rate;
+
+uint16_t ramp_max_period;
+uint16_t ramp_min_period;
+uint16_t ramp_cruise_period;
+
+static uint16_t us_to_ticks (uint32_t time_us, uint8_t shift)
+{
+	uint32_t ticks = (time_us << 5) >> shift;
+	
+	if (ticks > 0xFFFF)
+		return 0xFFFF;
+	
+	return (ticks) ? ticks : 1;
+}
+
+static uint16_t us_to_ramp_ticks (uint32_t time_us)
+{
+	return us_to_ticks(time_us, ramp_prescaler_shift);
+}
+
+static void select_ramp_prescaler (uint32_t end_us)
+{
+	uint8_t i = prescaler_index(m_max_pulse_interval_us);
+	
+	staged_prescaler = TIMER_PRESCALER_DIV1 + i;
+	staged_prescaler_shift = prescaler_shift[i];
+	ramp_tick_rate = 32000000.0 / ((uint16_t)1 << staged_prescaler_shift);
+	
+	ramp_max_period = us_to_ticks(m_max_pulse_interval_us, staged_prescaler_shift);
+	ramp_min_period = us_to_ticks(end_us, staged_prescaler_shift);
+	ramp_cruise_period = us_to_ticks(m_min_pulse_interval_us, staged_prescaler_shift);
+	staged_pulse_width = us_to_ticks(m_pulse_period_us, staged_prescaler_shift);
+}
+
+/************************************************************************/
+/* Ramp table                                                           */
+/************************************************************************/
+/* The periods of the acceleration ramp are computed once, every time a */
+/* ramp parameter changes, so the step ISR only needs to index a table. */
+/* Ramps longer than the table are sub-sampled by ramp_table_shift and  */
+/* the ISR interpolates between the entries, see ramp_step_up().      */
+/* A new table is built in the other buffer and a running move changes  */
+/* to it at its next pulse, see change_ramp_table().                    */
+uint16_t ramp_tables[2][RAMP_TABLE_SIZE];
+uint16_t *ramp_table = ramp_tables[0];
+uint8_t ramp_table_shift;
+uint32_t ramp_end_us;
+
+uint8_t ramp_active = 0;
+volatile bool ramp_staged = false;
+
+uint16_t *staged_table;
+uint8_t staged_table_shift;
+uint16_t staged_steps;
+uint16_t staged_cruise;
+uint32_t staged_end_us;
+
+uint16_t ramp_table_length;
+uint16_t ramp_table_steps;
+uint16_t ramp_table_last_period;
+
+static void ramp_table_compact (void)
+{
+	/* Table is full, keep only the even entries and double the stride */
+	for (uint16_t i = 0; i < RAMP_TABLE_SIZE / 2; i++)
+	{
+		staged_table[i] = staged_table[i << 1];
+	}
+	
+	ramp_table_length = RAMP_TABLE_SIZE / 2;
+	staged_table_shift++;
+}
+
+static void ramp_table_push (uint16_t period)
+{
+	if ((ramp_table_steps & ((1 << staged_table_shift) - 1)) == 0)
+	{
+		if (ramp_table_length == RAMP_TABLE_SIZE)
+			ramp_table_compact();
+		
+		if ((ramp_table_steps & ((1 << staged_table_shift) - 1)) == 0)
+		{
+			staged_table[ramp_table_length++] = period;
+		}
+	}
+	
+	ramp_table_steps++;
+	ramp_table_last_period = period;
+}
+
+static bool build_linear_ramp (void)
+{
+	/* In 24.8 fixed point so that coarse prescalers don't truncate the step */
+	uint32_t period = (uint32_t)ramp_max_period << 8;
+	uint32_t min_period = (uint32_t)ramp_min_period << 8;
+	uint32_t period_step = ((uint32_t)m_pulse_step_interval_us << 13) >> staged_prescaler_shift;
+	
+	if (period_step == 0)
+		return true;
+	
+	while (period - min_period > period_step)
+	{
+		/* The ramp is too long, the motor will run at the last reached speed */
+		if (ramp_table_steps == RAMP_MAX_STEPS)
+			return false;
+		
+		period -= period_step;
+		ramp_table_push(period >> 8);
+	}
+	
+	return true;
+}
+
+static bool build_s_curve_ramp (void)
+{
+	/* Velocities in steps/s */
+	float velocity = ramp_tick_rate / ramp_max_period;
+	float target_velocity = ramp_tick_rate / ramp_min_period;
+	float acceleration = 0;
+	float next_acceleration;
+	float next_velocity;
+	float landing;
+	float estimated_steps;
+	uint16_t block = 1;
+	uint16_t step = 0;
+	uint16_t period;
+	
+	if (m_acceleration == 0 || m_jerk == 0)
+		return true;
+	
+	/* Integrate blocks of steps so that long ramps don't take too long to compute. */
+	/* Each block ends on an entry of the table and the step ISR interpolates the   */
+	/* steps in between, so the periods don't change in stairs of a block.          */
+	estimated_steps  = (target_velocity * target_velocity - velocity * velocity) / (2 * (float)m_acceleration);
+	estimated_steps += target_velocity * m_acceleration / m_jerk;
+	
+	while ((estimated_steps / block > RAMP_TABLE_SIZE / 2) && (block < 0x100))
+	{
+		block <<= 1;
+		staged_table_shift++;
+	}
+	
+	while (step + block <= RAMP_MAX_STEPS)
+	{
+		/* Increase the acceleration with the jerk limit */
+		next_acceleration = acceleration + m_jerk * block / velocity;
+	
+		if (next_acceleration > m_acceleration)
+		{
+			next_acceleration = m_acceleration;
+		}
+	
+		/* Reduce the acceleration to zero when reaching the target velocity */
+		landing = 2 * (float)m_jerk * (target_velocity - velocity);
+	
+		if (next_acceleration * next_acceleration > landing)
+		{
+			next_acceleration = sqrt(landing);
+		}
+	
+		/* Each step is one step of distance: v^2 = v0^2 + 2*a, with the mean */
+		/* acceleration of the block                                          */
+		next_velocity = sqrt(velocity * velocity + (acceleration + next_acceleration) * block);
+		acceleration = next_acceleration;
+	
+		/* Stop if the float resolution doesn't allow to get closer */
+		if (next_velocity <= velocity)
+			return true;
+	
+		velocity = next_velocity;
+		period = ramp_tick_rate / velocity;
+	
+		if (period <= ramp_min_period)
+			return true;
+	
+		/* Only the last step of the block is stored, the others only need to be counted */
+		step += block;
+		ramp_table_steps = step;
+		ramp_table_push(period);
+	}
+	
+	/* The ramp is too long, the motor will run at the last reached speed */
+	return false;
+}
+
+static float constant_acceleration_step_index (uint16_t period)
+{
+	/* Step index n, counted from rest, where t(n+1) - t(n) = period, with t(n) = sqrt(2*n/a) */
+	float r = period / ramp_tick_rate * sqrt(m_acceleration / 2.0);
+	float root = (1 - r * r) / (2 * r);
+	
+	return (root > 0) ? root * root : 0;
+}
+
+static bool build_constant_acceleration_ramp (void)
+{
+	float first_step_n;
+	float last_step_n;
+	uint32_t step_n;
+	uint32_t steps;
+	uint32_t period;
+	uint32_t numerator;
+	uint32_t denominator;
+	uint32_t ratio;
+	uint16_t stride;
+	uint16_t i;
+	bool reached_nominal = true;
+	
+	if (m_acceleration == 0)
+		return true;
+	
+	first_step_n = constant_acceleration_step_index(ramp_max_period);
+	last_step_n = constant_acceleration_step_index(ramp_min_period);
+	
+	/* Exact number of steps between the initial and the nominal intervals */
+	steps = last_step_n - first_step_n + 0.5;
+	
+	if (steps > RAMP_MAX_STEPS)
+	{
+		steps = RAMP_MAX_STEPS;
+		reached_nominal = false;
+	}
+	
+	/* Only the entries stored in the table are computed, one every 2^shift steps, */
+	/* so the build takes at most 4*2^shift + RAMP_TABLE_SIZE iterations          */
+	while (((steps + (1 << staged_table_shift) - 1) >> staged_table_shift) > RAMP_TABLE_SIZE - 1)
+	{
+		staged_table_shift++;
+	}
+	
+	stride = 1 << staged_table_shift;
+	
+	/* Austin's recurrence, c(n) = c(n-1) - 2*c(n-1)/(4*n+1), in 24.8 fixed point */
+	step_n = first_step_n * 256;
+	period = (uint32_t)ramp_max_period << 8;
+	
+	/* Initial intervals longer than the first step from rest start the recurrence from rest */
+	if (first_step_n == 0 && ramp_tick_rate * sqrt(2.0 / m_acceleration) < ramp_max_period)
+	{
+		period = ramp_tick_rate * sqrt(2.0 / m_acceleration) * 256;
+	}
+	
+	/* Step by step while the period changes fast, 2*c/(4*n+1) is (c << 7)/(n + 64) in 24.8 */
+	for (i = 1; i < steps && i <= (stride << 2); i++)
+	{
+		step_n += 256;
+		period -= (period << 7) / (step_n + 64);
+		ramp_table_push((period + 0x80) >> 8);
+	}
+	
+	/* Then from entry to entry, c(n+m) = c(n)*sqrt((n+1/2)/(n+m+1/2)), with its */
+	/* Pade approximant (4*n + 2 + m)/(4*n + 2 + 3*m), below 0.05 % once n >= 4*m */
+	for (i += stride - 1; i < steps; i += stride)
+	{
+		numerator = step_n + 128 + ((uint32_t)stride << 6);
+		denominator = step_n + 128 + ((uint32_t)stride << 6) * 3;
+		
+		while (denominator > 0xFFFF)
+		{
+			numerator >>= 1;
+			denominator >>= 1;
+		}
+		
+		/* In 0.16 fixed point */
+		ratio = ((numerator << 16) + (denominator >> 1)) / denominator;
+		period = (((period >> 8) * ratio + 0x80) >> 8) + (((period & 0xFF) * ratio + 0x8000) >> 16);
+		
+		step_n += (uint32_t)stride << 8;
+		
+		/* The steps in between only need to be counted */
+		ramp_table_steps = i;
+		ramp_table_push((period + 0x80) >> 8);
+	}
+	
+	if (steps > ramp_table_steps)
+		ramp_table_steps = steps;
+	
+	return reached_nominal;
+}
+
+static uint16_t table_index_for_period (uint16_t *table, uint8_t shift, uint16_t steps, uint16_t period)
+{
+	/* Last ramp index with a period not shorter than the requested one */
+	uint16_t low = 0;
+	uint16_t high = steps >> shift;
+	uint16_t middle;
+	uint16_t span;
+	
+	if (table[high] >= period)
+		return steps;
+	
+	if (table[0] < period)
+		return 0;
+	
+	while (high - low > 1)
+	{
+		middle = (low + high) >> 1;
+		
+		if (table[middle] >= period)
+			low = middle;
+		else
+			high = middle;
+	}
+	
+	/* Between the two entries, as interpolated by ramp_step_up() */
+	span = table[low] - table[high];
+	
+	return (low << shift) + ((((uint32_t)(table[low] - period)) << shift) / span);
+}
+
+static void build_ramp_table (uint32_t end_us)
+{
+	/* Always into the buffer not in use by the step ISR */
+	staged_table = ramp_tables[ramp_active ^ 1];
+	staged_table_shift = 0;
+	ramp_table_length = 0;
+	ramp_table_steps = 0;
+	
+	select_ramp_prescaler(end_us);
+	ramp_table_push(ramp_max_period);
+	
+	if (ramp_max_period > ramp_min_period)
+	{
+		bool reached_nominal;
+		
+		switch (m_profile_type)
+		{
+			case GM_PROFILE_S_CURVE:
+				reached_nominal = build_s_curve_ramp();
+				break;
+			
+			case GM_PROFILE_CONSTANT_ACCELERATION:
+				reached_nominal = build_constant_acceleration_ramp();
+				break;
+			
+			default:
+				reached_nominal = build_linear_ramp();
+				break;
+		}
+		
+		if (reached_nominal)
+		{
+			ramp_table_push(ramp_min_period);
+		}
+	}
+	
+	/* The last step of the ramp always runs at the last period */
+	staged_steps = ramp_table_steps - 1;
+	
+	/* A sub-sampled ramp ends on an entry, its last steps are stretched up to it */
+	while (staged_steps & ((1 << staged_table_shift) - 1))
+	{
+		if ((staged_steps >> staged_table_shift) + 1 < RAMP_TABLE_SIZE)
+		{
+			staged_steps = ((staged_steps >> staged_table_shift) + 1) << staged_table_shift;
+			break;
+		}
+		
+		ramp_table_compact();
+	}
+	
+	staged_table[staged_steps >> staged_table_shift] = ramp_table_last_period;
+	staged_end_us = end_us;
+	
+	/* The table may go on past the nominal speed, see rebuild_ramp_table() */
+	staged_cruise = table_index_for_period(staged_table, staged_table_shift, staged_steps, ramp_cruise_period);
+}
 
 /************************************************************************/
 /* Update Global Parameters                                             */
 /************************************************************************/
 
-void update_nominal_pulse_interval (uint16_t time_us)
+void update_nominal_pulse_interval (uint32_t time_us)
+{
+	m_min_pulse_interval_us = time_us;
+	
+	rebuild_ramp_table();
+}
+
+void update_initial_pulse_interval (uint32_t time_us)
+{
+	m_max_pulse_interval_us = time_us;
+	
+	rebuild_ramp_table();
+}
+
+void update_pulse_step_interval (uint16_t time_us)
+{
+	m_pulse_step_interval_us = time_us;
+	
+	rebuild_ramp_table();
+}
+
+void update_pulse_period (uint16_t time_us)
+{
+	m_pulse_period_us = time_us;
+	
+	rebuild_ramp_table();
+}
+
+void update_profile_type (uint8_t profile_type)
+{
+	m_profile_type = profile_type;
+	
+	rebuild_ramp_table();
+}
+
+void update_acceleration (uint32_t acceleration)
+{
+	m_acceleration = acceleration;
+	
+	rebuild_ramp_table();
+}
+
+void update_jerk (uint32_t jerk)
+{
+	m_jerk = jerk;
+	
+	rebuild_ramp_table();
+}
+
+void update_motion_parameters (uint32_t nominal_us, uint32_t initial_us, uint16_t step_us, uint16_t period_us, uint8_t profile_type, uint32_t acceleration, uint32_t jerk)
+{
+	/* Build the ramp table only once for all the parameters */
+	m_min_pulse_interval_us = nominal_us;
+	m_max_pulse_interval_us = initial_us;
+	m_pulse_step_interval_us = step_us;
+	m_pulse_period_us = period_us;
+	m_profile_type = profile_type;
+	m_acceleration = acceleration;
+	m_jerk = jerk;
+	
+	rebuild_ramp_table();
+}
+
+/************************************************************************/
+/* Globals                                                              */
+/************************************************************************/
+uint32_t steps_target;
+uint32_t steps_count;
+uint32_t steps_remaining;
+
+uint16_t ramp_index;
+uint16_t ramp_limit;
+uint32_t cruise_interval_us;	// Cruise interval of the segment, 0 for the nominal speed
+
+uint32_t accel_end_step;
+uint32_t decel_start_step;
+
+bool motor_is_running = false;
+bool moving_positive;
+bool decreasing_speed;
+
+bool send_motor_stopped_notification = false;
+
+uint32_t reversal_steps = 0;
+
+int32_t motor_position = 0;
+
+/* Counts the step ISRs and the scheduled starts, for the reads from the lower levels */
+volatile uint8_t step_isr_sequence = 0;
+
+bool closed_loop = false;
+int16_t m_steps_per_count;
+uint16_t m_closed_loop_kp;
+uint16_t m_closed_loop_ki;
+
+int32_t position_correction = 0;
+int32_t closed_loop_anchor = 0;
+int32_t closed_loop_anchor_correction = 0;
+int32_t closed_loop_counts = 0;
+int16_t closed_loop_previous_encoder;
+int32_t closed_loop_integral = 0;
+int32_t closed_loop_error = 0;
+
+/************************************************************************/
+/* Profile planning                                                     */
+/************************************************************************/
+/* The profile of a move is planned from the step count in planned_step */
+/* with ramp_index already loaded for the next step. The step ISR moves */
+/* the ramp index one step toward ramp_limit until accel_end_step and   */
+/* decelerates from decel_start_step, so that the last step runs at the */
+/* first period of the ramp. Moves too short to reach ramp_limit get a  */
+/* symmetric triangular profile. It's planned again every time the      */
+/* target, the cruise speed or the ramp index change during the move.   */
+static void plan_profile (uint32_t planned_step)
+{
+	uint32_t steps_left = steps_target - planned_step;
+	uint16_t peak;
+	
+	if (steps_left <= ramp_index)
+	{
+		/* Too late to stop smoothly, decelerate right away */
+		accel_end_step = planned_step;
+		decel_start_step = planned_step + 1;
+		return;
+	}
+	
+	if (ramp_index > ramp_limit)
+	{
+		/* Slow down to the cruise speed of the segment */
+		peak = ramp_limit;
+		accel_end_step = planned_step + (ramp_index - ramp_limit);
+	}
+	else
+	{
+		/* Accelerate until the cruise speed or half of the steps left */
+		peak = ramp_limit;
+		
+		if ((steps_left - 1 - ramp_index) >> 1 < (uint32_t)(ramp_limit - ramp_index))
+		{
+			peak = ramp_index + ((steps_left - 1 - ramp_index) >> 1);
+		}
+		
+		accel_end_step = planned_step + (peak - ramp_index);
+	}
+	
+	/* The step n from the end runs at the ramp index n */
+	decel_start_step = steps_target - 1 - peak;
+}
+
+/************************************************************************/
+/* Ramp stepping                                                        */
+/************************************************************************/
+/* The step ISR moves along the ramp one index at a time. The period of */
+/* ramp_index is kept with 8 fractional bits and the change from one    */
+/* index to the next is loaded once for each entry of the table, so a   */
+/* step costs one add, and one multiply on the entries. The products    */
+/* are exact, the periods are the linear interpolation between entries  */
+/* rounded up. The jumps to another index go through ramp_seek().       */
+uint16_t *ramp_entry;			// Entry of ramp_index, or the last one before it
+uint32_t ramp_step_period;		// Period of ramp_index in ticks with 8 fractional bits
+uint32_t ramp_step_delta;		// Change of the period from one index to the next in the entry
+uint16_t ramp_fraction_mask;	// Index within the entry
+uint16_t ramp_delta_scale;		// 256 >> ramp_table_shift
+
+static void ramp_seek (uint16_t index)
+{
+	uint16_t fraction = index & ramp_fraction_mask;
+	
+	ramp_index = index;
+	ramp_entry = &ramp_table[index >> ramp_table_shift];
+	ramp_step_period = (uint32_t)ramp_entry[0] << 8;
+	
+	if (fraction)
+	{
+		ramp_step_delta = (uint32_t)(ramp_entry[0] - ramp_entry[1]) * ramp_delta_scale;
+		ramp_step_period -= ramp_step_delta * fraction;
+	}
+}
+
+static inline void ramp_step_up (void)
+{
+	if ((ramp_index & ramp_fraction_mask) == 0)
+		ramp_step_delta = (uint32_t)(ramp_entry[0] - ramp_entry[1]) * ramp_delta_scale;
+	
+	ramp_step_period -= ramp_step_delta;
+	ramp_index++;
+	
+	if ((ramp_index & ramp_fraction_mask) == 0)
+		ramp_entry++;
+}
+
+static inline void ramp_step_down (void)
+{
+	if ((ramp_index & ramp_fraction_mask) == 0)
+	{
+		ramp_entry--;
+		ramp_step_delta = (uint32_t)(ramp_entry[0] - ramp_entry[1]) * ramp_delta_scale;
+	}
+	
+	ramp_step_period += ramp_step_delta;
+	ramp_index--;
+}
+
+static inline uint16_t ramp_ticks (void)
+{
+	return (ramp_step_period + 0xFF) >> 8;
+}
+
+/************************************************************************/
+/* Segments queue                                                       */
+/************************************************************************/
+/* The segments at the head of the queue with the same direction of the */
+/* current move are already added to steps_target (run_segments) and    */
+/* are only used to update the cruise speed when their turn arrives.    */
+typedef struct
+{
+	int32_t steps;
+	uint32_t period;	// Pulse interval in microseconds
+} motion_segment_t;
+
+motion_segment_t segment_queue[SEGMENT_QUEUE_SIZE];
+uint8_t segment_queue_head = 0;
+uint8_t segment_queue_tail = 0;
+uint8_t segment_queue_count = 0;
+
+uint8_t run_segments = 0;
+uint32_t segment_end;
+
+static uint16_t ramp_index_for_period (uint16_t period)
+{
+	return table_index_for_period(ramp_table, ramp_table_shift, ramp_steps, period);
+}
+
+static uint32_t segment_steps (motion_segment_t *segment)
+{
+	return (segment->steps > 0) ? (uint32_t)segment->steps : (uint32_t)(~segment->steps + 1);
+}
+
+static void pop_segment (void)
+{
+	segment_queue_head = (segment_queue_head + 1) & (SEGMENT_QUEUE_SIZE - 1);
+	segment_queue_count--;
+}
+
+static void load_queued_run (void)
+{
+	motion_segment_t *segment = &segment_queue[segment_queue_head];
+	uint8_t index;
+	
+	if (segment->steps > 0)
+	{
+		set_MOTOR_DIRECTION;
+		moving_positive = true;
+	}
+	else
+	{
+		clr_MOTOR_DIRECTION;
+		moving_positive = false;
+	}
+	
+	steps_target = segment_steps(segment);
+	segment_end = steps_target;
+	cruise_interval_us = segment->period;
+	ramp_limit = ramp_index_for_period(us_to_ramp_ticks(segment->period));
+	pop_segment();
+	
+	/* Join the next segments with the same direction to this move */
+	run_segments = 0;
+	index = segment_queue_head;
+	
+	while (run_segments < segment_queue_count)
+	{
+		segment = &segment_queue[index];
+		
+		if ((segment->steps > 0) != moving_positive)
+			break;
+		
+		steps_target += segment_steps(segment);
+		run_segments++;
+		index = (index + 1) & (SEGMENT_QUEUE_SIZE - 1);
+	}
+	
+	steps_count = 0;				// Reset steps counter
+	steps_remaining = 0;			// Reset remaining steps
+	ramp_seek(0);				// Start from the beginning of the ramp
+	decreasing_speed = false;	// Reset decreasing speed flag
+	
+	plan_profile(0);
+}
+
+bool enqueue_motion_segment (int32_t steps, uint32_t time_us)
+{
+	motion_segment_t *segment = &segment_queue[segment_queue_tail];
+	
+	if (segment_queue_count == SEGMENT_QUEUE_SIZE)
+		return false;
+	
+	segment->steps = steps;
+	segment->period = time_us;
+	
+	/* Extend the current move if all the queued segments belong to it */
+	if (motor_is_running && (run_segments == segment_queue_count) && ((steps > 0) == moving_positive))
+	{
+		if (run_segments == 0)
+		{
+			segment_end = steps_target;
+		}
+		
+		steps_target += segment_steps(segment);
+		run_segments++;
+		
+		plan_profile(steps_count);
+	}
+	
+	segment_queue_tail = (segment_queue_tail + 1) & (SEGMENT_QUEUE_SIZE - 1);
+	segment_queue_count++;
+	
+	return true;
+}
+
+uint8_t get_segment_queue_space (void)
+{
+	return SEGMENT_QUEUE_SIZE - segment_queue_count;
+}
+
+/************************************************************************/
+/* Velocity mode                                                        */
+/************************************************************************/
+/* Velocities are in steps/s with 16 fractional bits. The velocity is   */
+/* ramped every millisecond and the ISR only loads the new period.      */
+/* The update is posted to the slot not selected by the sequence, and   */
+/* the step ISR copies it to its own variables at the next overflow.    */
+typedef struct
+{
+	uint16_t period;
+	uint32_t dds_increment;
+	bool positive;
+	bool stop;
+} velocity_update_t;
+
+velocity_update_t velocity_slots[2];
+volatile uint8_t velocity_post_sequence = 0;
+uint8_t velocity_take_sequence = 0;
+
+bool velocity_mode = false;
+bool velocity_positive;
+bool velocity_stop;
+
+int32_t velocity_current;
+int32_t velocity_target;
+int32_t velocity_increment;
+int32_t velocity_start;
+uint16_t velocity_period;		// TCC0_PER of the velocity timer, in ticks of 2 us
+
+bool waveform_playing = false;
+
+/* With the DDS step generator TCC0 runs at a fixed rate and a pulse is */
+/* scheduled for the next tick every time the phase accumulator wraps.  */
+uint8_t m_step_generator;
+uint32_t dds_phase;
+uint32_t dds_increment;
+uint16_t dds_pulse_width;
+bool dds_pulse;
+
+static inline void take_velocity_update (void)
+{
+	velocity_update_t *update;
+	
+	/* The waveforms load their samples from TCE0 */
+	if (waveform_playing || velocity_take_sequence == velocity_post_sequence)
+		return;
+	
+	velocity_take_sequence = velocity_post_sequence;
+	update = &velocity_slots[velocity_take_sequence & 1];
+	
+	velocity_period = update->period;
+	dds_increment = update->dds_increment;
+	velocity_positive = update->positive;
+	velocity_stop = update->stop;
+}
+
+static void start_velocity_timer (void)
+{
+	if (m_step_generator == GM_GENERATOR_DDS)
+	{
+		dds_phase = 0;
+		dds_pulse = false;
+		
+		if (velocity_positive)
+			set_MOTOR_DIRECTION;
+		else
+			clr_MOTOR_DIRECTION;
+		
+		moving_positive = velocity_positive;
+		
+		/* The pulse must end within the tick */
+		dds_pulse_width = (m_pulse_period_us < DDS_TICK_PERIOD / 64) ? m_pulse_period_us << 5 : DDS_TICK_PERIOD / 2;
+		
+		/* No pulse on the first tick and only the overflow interrupt */
+		timer_type0_pwm(&TCC0, TIMER_PRESCALER_DIV1, DDS_TICK_PERIOD - 1, 0, INT_LEVEL_MED, INT_LEVEL_OFF);
+	}
+	else
+	{
+		timer_type0_pwm(&TCC0, TIMER_PRESCALER_DIV64, velocity_period, m_pulse_period_us >> 1, INT_LEVEL_MED, INT_LEVEL_MED);
+	}
+}
+
+void update_step_generator (uint8_t step_generator)
+{
+	m_step_generator = step_generator;
+}
+
+static uint16_t velocity_to_period (int32_t velocity)
+{
+	uint32_t speed = (velocity > 0) ? velocity : -velocity;
+	
+	/* Slower than the velocity timer can go */
+	if (speed < ((uint32_t)WAVEFORM_MIN_VELOCITY << 16))
+		speed = (uint32_t)WAVEFORM_MIN_VELOCITY << 16;
+	
+	/* In ticks of 2 us, minus one for TCC0_PER */
+	return 128000000UL / (speed >> 8) - 1;
+}
+
+void set_target_velocity (int16_t velocity)
+{
+	uint32_t initial_us;
+	
+	velocity_target = (int32_t)velocity << 16;
+	
+	if (velocity_mode || velocity == 0)
+		return;
+	
+	/* Start from the initial pulse interval, like the ramped moves */
+	/* The DDS step generator starts from zero */
+	/* The velocity timer runs at 500 KHz, slow initial intervals start from the minimum velocity */
+	initial_us = (m_max_pulse_interval_us < 1000000UL / WAVEFORM_MIN_VELOCITY) ? m_max_pulse_interval_us : 1000000UL / WAVEFORM_MIN_VELOCITY;
+	velocity_start = (m_step_generator == GM_GENERATOR_DDS) ? 0 : (256000000UL / initial_us) << 8;
+	velocity_increment = ((uint64_t)m_acceleration << 16) / 1000;
+	velocity_period = (initial_us >> 1) - 1;
+	velocity_stop = false;
+	dds_increment = 0;
+	
+	if (velocity > 0)
+	{
+		set_MOTOR_DIRECTION;
+		moving_positive = true;
+		velocity_current = velocity_start;
+	}
+	else
+	{
+		clr_MOTOR_DIRECTION;
+		moving_positive = false;
+		velocity_current = -velocity_start;
+	}
+	
+	/* Targets below the initial speed are reached right away */
+	if ((velocity_target < velocity_start) && (velocity_target > -velocity_start))
+	{
+		velocity_current = velocity_target;
+		velocity_period = velocity_to_period(velocity_current);
+	}
+	
+	velocity_positive = moving_positive;
+	
+	/* The step ISR isn't running yet, the updates start from here */
+	velocity_take_sequence = velocity_post_sequence;
+	velocity_slots[velocity_take_sequence & 1].period = velocity_period;
+	velocity_slots[velocity_take_sequence & 1].dds_increment = dds_increment;
+	velocity_slots[velocity_take_sequence & 1].positive = velocity_positive;
+	velocity_slots[velocity_take_sequence & 1].stop = velocity_stop;
+	
+	velocity_mode = true;
+	
+	start_velocity_timer();
+}
+
+void set_velocity_acceleration (uint32_t acceleration)
+{
+	/* Until the next velocity move, which starts with m_acceleration */
+	velocity_increment = ((uint64_t)acceleration << 16) / 1000;
+}
+
+void update_velocity_mode (void)
+{
+	uint8_t sequence = velocity_post_sequence;
+	velocity_update_t update = velocity_slots[sequence & 1];
+	uint32_t speed;
+	
+	if (velocity_mode == false || waveform_playing)
+		return;
+	
+	/* Move toward the target velocity with the configured acceleration */
+	/* The sum could overflow close to the fastest velocities, the distance to the target can't */
+	if (velocity_current < velocity_target)
+	{
+		if ((uint32_t)velocity_target - (uint32_t)velocity_current > (uint32_t)velocity_increment)
+			velocity_current += velocity_increment;
+		else
+			velocity_current = velocity_target;
+	}
+	else if (velocity_current > velocity_target)
+	{
+		if ((uint32_t)velocity_current - (uint32_t)velocity_target > (uint32_t)velocity_increment)
+			velocity_current -= velocity_increment;
+		else
+			velocity_current = velocity_target;
+	}
+	
+	if (m_step_generator == GM_GENERATOR_DDS)
+	{
+		update.stop = (velocity_current == 0) && (velocity_target == 0);
+		
+		if (velocity_current != 0)
+			update.positive = (velocity_current > 0);
+		
+		speed = (velocity_current > 0) ? velocity_current : -velocity_current;
+		update.dds_increment = ((uint64_t)speed * DDS_VELOCITY_SCALE) >> 16;
+	}
+	else
+	{
+		/* Below the initial speed the motor starts, stops and turns around without a ramp */
+		/* The ramp only runs between speeds above it                                     */
+		update.stop = false;
+		
+		if ((velocity_current < velocity_start) && (velocity_current > -velocity_start))
+		{
+			if ((velocity_target < velocity_start) && (velocity_target > -velocity_start))
+				velocity_current = velocity_target;
+			else
+				velocity_current = (velocity_target > 0) ? velocity_start : -velocity_start;
+			
+			if (velocity_current == 0)
+				update.stop = true;
+		}
+		
+		if (update.stop == false)
+		{
+			update.positive = (velocity_current > 0);
+			update.period = velocity_to_period(velocity_current);
+		}
+	}
+	
+	velocity_slots[(sequence + 1) & 1] = update;
+	velocity_post_sequence = sequence + 1;
+}
+
+bool get_velocity_mode (void)
+{
+	return velocity_mode;
+}
+
+/************************************************************************/
+/* Hardware step counter                                                */
+/************************************************************************/
+/* TCE0 counts the TCC0 overflows, one for each pulse, through the      */
+/* event channel 2. It's used by the immediate pulses and by the cruise */
+/* of the ramped moves, which never run together with the waveforms.   */
+static void start_step_counter (uint16_t period, uint8_t int_level)
+{
+	EVSYS_CH2MUX = EVSYS_CHMUX_TCC0_OVF_gc;
+	
+	TCE0_CTRLA = TC_CLKSEL_OFF_gc;
+	TCE0_CTRLFSET = TC_CMD_RESET_gc;
+	
+	TCE0_PER = period;
+	TCE0_INTCTRLA = int_level;
+	TCE0_CTRLA = TC_CLKSEL_EVCH2_gc;
+}
+
+/************************************************************************/
+/* Compare of the ramped moves                                          */
+/************************************************************************/
+/* The compare interrupt of a ramped move only runs at the steps where  */
+/* the move changes, see plan_step_compare(), and after a request or a  */
+/* new ramp is posted. The overflow turns it on at compare_step.        */
+uint32_t compare_step;
+
+static void request_step_compare (void)
+{
+	/* The flag of an earlier pulse would run it right away */
+	TCC0_INTFLAGS = TC0_CCAIF_bm;
+	TCC0_INTCTRLB = INT_LEVEL_MED;
+}
+
+/************************************************************************/
+/* Hardware cruise                                                      */
+/************************************************************************/
+/* When a ramped move reaches its cruise speed, the step interrupts are */
+/* turned off and TCE0 counts the pulses until the deceleration. The    */
+/* overflow that ends the count stays pending on TCC0, so the step ISR  */
+/* takes over again with the pulse where the deceleration starts.       */
+bool m_hardware_cruise = false;
+bool hardware_cruise = false;
+bool hardware_cruise_blocked = false;
+
+void update_hardware_cruise (bool enable)
+{
+	m_hardware_cruise = enable;
+}
+
+static void start_hardware_cruise (uint32_t steps)
+{
+	/* Longer cruises are split, the step ISR starts the next one */
+	if (steps > 0x10000)
+		steps = 0x10000;
+	
+	hardware_cruise = true;
+	
+	TCC0_INTCTRLA = INT_LEVEL_OFF;
+	TCC0_INTCTRLB = INT_LEVEL_OFF;
+	
+	start_step_counter(steps - 1, INT_LEVEL_MED);
+}
+
+static uint32_t hardware_cruise_steps (void)
+{
+	/* The counter may have wrapped with its interrupt still pending */
+	if (TCE0_INTFLAGS & TC0_OVFIF_bm)
+		return (uint32_t)TCE0_PER + 1 + TCE0_CNT;
+	
+	return TCE0_CNT;
+}
+
+static void end_hardware_cruise (void)
+{
+	/* The last overflow before the wrap is counted by the step ISR */
+	uint32_t steps = (uint32_t)TCE0_PER + TCE0_CNT;
+	
+	timer_type0_stop(&TCE0);
+	hardware_cruise = false;
+	
+	steps_count += steps;
+	
+	if (moving_positive)
+		motor_position += steps;
+	else
+		motor_position -= steps;
+	
+	/* The compare of the current pulse may be stale */
+	TCC0_INTFLAGS = TC0_CCAIF_bm;
+	TCC0_INTCTRLB = INT_LEVEL_MED;
+	TCC0_INTCTRLA = INT_LEVEL_MED;
+}
+
+static void cut_hardware_cruise (void)
+{
+	uint32_t steps;
+	
+	/* The pulses until TCE0 stops are counted by it, the later ones by the step ISR */
+	TCC0_INTFLAGS = TC0_OVFIF_bm;
+	TCE0_CTRLA = TC_CLKSEL_OFF_gc;
+	
+	steps = hardware_cruise_steps();
+	
+	timer_type0_stop(&TCE0);
+	hardware_cruise = false;
+	
+	steps_count += steps;
+	
+	if (moving_positive)
+		motor_position += steps;
+	else
+		motor_position -= steps;
+	
+	/* The compare of the current pulse may be stale */
+	TCC0_INTFLAGS = TC0_CCAIF_bm;
+	TCC0_INTCTRLB = INT_LEVEL_MED;
+}
+
+static bool request_hardware_cruise_end (void)
+{
+	/* Don't start a new cruise before the caller is done */
+	hardware_cruise_blocked = true;
+	
+	/* No cruise can start from now on, the compare takes the change */
+	if (hardware_cruise == false)
+	{
+		if (motor_is_running && !velocity_mode)
+			request_step_compare();
+		
+		return false;
+	}
+	
+	/* The overflow flag is pending since the first pulse of the cruise, */
+	/* so the step ISR runs right away and cuts it, see step_overflow()  */
+	TCC0_INTCTRLA = INT_LEVEL_MED;
+	
+	return true;
+}
+
+/************************************************************************/
+/* Request mailbox                                                      */
+/************************************************************************/
+/* The step requests are posted from the low level interrupts and taken */
+/* by the step ISR at the next pulse, or by the scheduled start. The    */
+/* poster adds the steps to a running total in the slot not selected by */
+/* the sequence and then moves the sequence on, so the taker always     */
+/* reads a whole total and the posts never wait for the last one to be  */
+/* taken. Nothing is masked. The totals wrap around, only their         */
+/* difference with the steps taken matters.                             */
+uint32_t mailbox_slots[2];
+volatile uint8_t mailbox_sequence = 0;
+uint32_t mailbox_taken = 0;
+
+static void mailbox_post (int32_t steps)
+{
+	uint8_t sequence = mailbox_sequence;
+	
+	mailbox_slots[(sequence + 1) & 1] = mailbox_slots[sequence & 1] + (uint32_t)steps;
+	mailbox_sequence = sequence + 1;
+}
+
+static int32_t mailbox_peek (void)
+{
+	return (int32_t)(mailbox_slots[mailbox_sequence & 1] - mailbox_taken);
+}
+
+static bool mailbox_pending (void)
+{
+	return mailbox_slots[mailbox_sequence & 1] != mailbox_taken;
+}
+
+static int32_t mailbox_take (void)
+{
+	/* Only from the step ISRs, or while they can't run */
+	int32_t steps = mailbox_peek();
+	
+	mailbox_taken += (uint32_t)steps;
+	
+	return steps;
+}
+
+static void take_steps_request (void)
+{
+	int32_t steps = mailbox_take();
+	int32_t steps_ahead;
+	uint32_t steps_to_stop;
+	
+	/* Steps still to go in the current direction once the request is applied */
+	steps_ahead = (int32_t)(steps_target - steps_count) - (int32_t)reversal_steps;
+	steps_ahead += (moving_positive) ? steps : -steps;
+	
+	hardware_cruise_blocked = false;
+	
+	/* Steps needed to decelerate from the current speed, including the current pulse */
+	steps_to_stop = (uint32_t)ramp_index + 1;
+	
+	if (steps_to_stop > steps_target - steps_count)
+	{
+		steps_to_stop = steps_target - steps_count;
+	}
+	
+	if (steps_ahead >= (int32_t)steps_to_stop)
+	{
+		steps_target = steps_count + steps_ahead;
+		reversal_steps = 0;
+	}
+	else
+	{
+		/* Decelerate to zero and continue in the opposite direction */
+		steps_target = steps_count + steps_to_stop;
+		reversal_steps = steps_to_stop - steps_ahead;
+	}
+	
+	plan_profile(steps_count);
+}
+
+/************************************************************************/
+/* Step trace                                                           */
+/************************************************************************/
+/* When enabled, the step ISR of the ramped moves records the period of */
+/* each step and if it was decelerating. Only the last STEP_TRACE_SIZE  */
+/* steps are kept and the host reads them in chunks.                    */
+uint16_t step_trace[STEP_TRACE_SIZE];
+uint8_t step_trace_decreasing[STEP_TRACE_SIZE / 8];
+uint16_t step_trace_head;
+uint32_t step_trace_steps;
+uint8_t step_trace_prescaler;
+bool step_trace_enabled = false;
+
+void set_step_trace (bool enable)
+{
+	step_trace_enabled = enable;
+	
+	if (enable)
+	{
+		step_trace_head = 0;
+		step_trace_steps = 0;
+		step_trace_prescaler = ramp_prescaler;
+	}
+}
+
+static void record_step_trace (uint16_t period)
+{
+	uint8_t mask = 1 << (step_trace_head & 7);
+	
+	step_trace[step_trace_head] = period;
+	
+	if (decreasing_speed)
+		step_trace_decreasing[step_trace_head >> 3] |= mask;
+	else
+		step_trace_decreasing[step_trace_head >> 3] &= ~mask;
+	
+	step_trace_head = (step_trace_head + 1) & (STEP_TRACE_SIZE - 1);
+	step_trace_steps++;
+}
+
+uint32_t get_step_trace_steps (void)
+{
+	return step_trace_steps;
+}
+
+void read_step_trace (uint16_t index, uint32_t *entries, uint8_t n_entries)
+{
+	/* The index counts from the oldest step still in the buffer */
+	uint16_t length = (step_trace_steps < STEP_TRACE_SIZE) ? step_trace_steps : STEP_TRACE_SIZE;
+	uint16_t oldest = (step_trace_steps < STEP_TRACE_SIZE) ? 0 : step_trace_head;
+	uint16_t position;
+	
+	for (uint8_t i = 0; i < n_entries; i++, index++)
+	{
+		if (index >= length)
+		{
+			entries[i] = 0;
+			continue;
+		}
+		
+		position = (oldest + index) & (STEP_TRACE_SIZE - 1);
+		
+		entries[i] = step_trace[position] | ((uint32_t)step_trace_prescaler << 16);
+		
+		if (step_trace_decreasing[position >> 3] & (1 << (position & 7)))
+			entries[i] |= STEP_TRACE_DECREASING;
+	}
+}
+
+/************************************************************************/
+/* Ramp changes                                                         */
+/************************************************************************/
+/* The ramp parameters can change during a ramped move. The new table   */
+/* is built in the low level interrupts and staged. The compare of the  */
+/* step ISR changes to it and the next overflow loads the timer, so the */
+/* new ramp applies from the next pulse. The current speed is kept, and */
+/* the move goes on to the new cruise speed from there.                 */
+bool ramp_timer_pending = false;
+
+bool get_ramped_move (void)
+{
+	return motor_is_running;
+}
+
+bool get_move_waiting (void)
+{
+	/* Posted while stopped, the move starts once the ramp is built */
+	return !motor_is_running && !get_scheduled_start() && mailbox_pending();
+}
+
+static void use_staged_ramp_table (void)
+{
+	ramp_active ^= 1;
+	ramp_table = ramp_tables[ramp_active];
+	ramp_table_shift = staged_table_shift;
+	ramp_fraction_mask = (1 << ramp_table_shift) - 1;
+	ramp_delta_scale = 256 >> ramp_table_shift;
+	ramp_steps = staged_steps;
+	ramp_cruise = staged_cruise;
+	ramp_end_us = staged_end_us;
+	
+	ramp_prescaler = staged_prescaler;
+	ramp_prescaler_shift = staged_prescaler_shift;
+	ramp_pulse_width = staged_pulse_width;
+	
+	ramp_staged = false;
+}
+
+static void change_ramp_table (void)
+{
+	/* Period of the current pulse in CPU cycles */
+	uint32_t period = (uint32_t)ramp_ticks() << ramp_prescaler_shift;
+	
+	use_staged_ramp_table();
+	
+	period >>= ramp_prescaler_shift;
+	
+	/* Carry on from the same speed, or from the closest one of the new ramp */
+	ramp_seek(ramp_index_for_period((period > 0xFFFF) ? 0xFFFF : period));
+	
+	if (cruise_interval_us)
+		ramp_limit = ramp_index_for_period(us_to_ramp_ticks(cruise_interval_us));
+	else
+		ramp_limit = ramp_cruise;
+	
+	if (ramp_limit > ramp_cruise)
+		ramp_limit = ramp_cruise;
+	
+	/* The new ramp may need another hardware cruise */
+	hardware_cruise_blocked = false;
+	
+	/* The timer changes to the new ramp with the next pulse */
+	ramp_timer_pending = true;
+	
+	plan_profile(steps_count);
+}
+
+static void load_ramp_timer (void)
+{
+	if (TCC0_CTRLA != ramp_prescaler)
+	{
+		TCC0_CTRLA = ramp_prescaler;
+		
+		/* The periods of a trace must share the same time base */
+		if (step_trace_enabled)
+			set_step_trace(true);
+	}
+	
+	TCC0_CCA = ramp_pulse_width;
+	
+	ramp_timer_pending = false;
+}
+
+/* The registers only ask for a new table, built by the main loop so  */
+/* that the Harp commands, the 1 ms callback and the external control  */
+/* keep running at the low level while it is computed. A request taken */
+/* during the build restarts it, and the build is only published if no */
+/* other one was asked meanwhile. The moves requested while stopped    */
+/* wait for it in the mailbox, see user_sent_request().                */
+volatile uint8_t ramp_build_request = 0;
+uint8_t ramp_build_done = 0;
+
+void rebuild_ramp_table (void)
+{
+	/* A staged table not used yet is discarded, its buffer is rebuilt */
+	ramp_staged = false;
+	ramp_build_request++;
+}
+
+bool get_ramp_building (void)
+{
+	return ramp_build_request != ramp_build_done;
+}
+
+void build_pending_ramp_table (void)
+{
+	uint8_t request;
+	uint32_t end_us;
+	
+	while (ramp_build_request != ramp_build_done)
+	{
+		request = ramp_build_request;
+		end_us = m_min_pulse_interval_us;
+		
+		/* When slowing down, the new table goes on up to the current ramp */
+		/* so that the move can decelerate along it to the new cruise speed */
+		if (motor_is_running && ramp_end_us < end_us)
+			end_us = ramp_end_us;
+		
+		/* Unless the current ramp is too fast for the new initial interval */
+		if (check_ramp_intervals(end_us, m_max_pulse_interval_us) == false)
+			end_us = m_min_pulse_interval_us;
+		
+		build_ramp_table(end_us);
+		
+		/* Disable low level interrupts */
+		PMIC_CTRL = PMIC_RREN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+		
+		if (request == ramp_build_request)
+		{
+			if (motor_is_running || get_scheduled_start())
+			{
+				/* Changed by the step ISR at the next pulse, or at the next start */
+				ramp_staged = true;
+				request_hardware_cruise_end();
+			}
+			else
+			{
+				use_staged_ramp_table();
+				
+				/* The move requested during the build */
+				if (mailbox_pending())
+					start_rotation(mailbox_take());
+			}
+		}
+		
+		ramp_build_done = request;
+		
+		/* Re-enable all interrupt levels */
+		PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+	}
+}
+
+/************************************************************************/
+/* Waveform playback                                                    */
+/************************************************************************/
+/* The samples are velocities in steps/s, loaded by TCE0 at a fixed     */
+/* rate. Samples below the slowest period that TCC0 can generate pause  */
+/* the pulses until a faster sample arrives.                            */
+int16_t waveform[WAVEFORM_SIZE];
+uint16_t waveform_length = 0;
+uint16_t waveform_upload_index = 0;
+uint16_t waveform_index;
+uint16_t waveform_sample_interval_us;
+
+bool waveform_loop;
+bool waveform_pause;
+bool waveform_done = false;
+
+static void load_waveform_sample (int16_t velocity)
+{
+	uint16_t speed = (velocity > 0) ? velocity : -velocity;
+	
+	if (m_step_generator == GM_GENERATOR_DDS)
+	{
+		if (velocity != 0)
+			velocity_positive = (velocity > 0);
+		
+		dds_increment = speed * DDS_VELOCITY_SCALE;
+		return;
+	}
+	
+	if (speed < WAVEFORM_MIN_VELOCITY)
+	{
+		waveform_pause = true;
+		return;
+	}
+	
+	waveform_pause = false;
+	velocity_period = 500000UL / speed - 1;
+	velocity_positive = (velocity > 0);
+	
+	if (TCC0_CTRLA)
+	{
+		/* Apply the new period to the interval in progress, so a slow */
+		/* interval doesn't delay the next pulse when the speed rises  */
+		uint16_t count = TCC0_CNT + 2;
+		
+		if (count < TCC0_CCA + 2)
+			count = TCC0_CCA + 2;
+		
+		TCC0_PER = (velocity_period > count) ? velocity_period : count;
+	}
+	else
+	{
+		/* Restart the pulses after a pause */
+		if (velocity_positive)
+			set_MOTOR_DIRECTION;
+		else
+			clr_MOTOR_DIRECTION;
+		
+		moving_positive = velocity_positive;
+		
+		timer_type0_pwm(&TCC0, TIMER_PRESCALER_DIV64, velocity_period, m_pulse_period_us >> 1, INT_LEVEL_MED, INT_LEVEL_MED);
+	}
+}
+
+/* One cycle of the sine, with 15 fractional bits */
+const int16_t sine_table[256] PROGMEM = {
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+	6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+	27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+	32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285,
+	32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+	30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683,
+	27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+	23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868,
+	18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+	12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+	6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+	0, -804, -1608, -2410, -3212, -4011, -4808, -5602,
+	-6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+	-18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+	-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+	-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+	-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+	-32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+	-32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+	-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+	-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+	-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+	-18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179,
+	-6393, -5602, -4808, -4011, -3212, -2410, -1608, -804
+};
+
+bool oscillation = false;
+uint32_t oscillation_phase;
+uint32_t oscillation_phase_increment;
+uint32_t oscillation_elapsed;
+uint16_t oscillation_cycles;
+uint16_t oscillation_amplitude;
+
+static int16_t oscillation_sample (void)
+{
+	/* Linear interpolation between the two closest entries of the table */
+	uint8_t index = oscillation_phase >> 24;
+	int16_t fraction = (oscillation_phase >> 16) & 0xFF;
+	int16_t sine = pgm_read_word(&sine_table[index]);
+	int16_t next = pgm_read_word(&sine_table[(uint8_t)(index + 1)]);
+	
+	sine += ((int32_t)(next - sine) * fraction + 128) >> 8;
+	
+	return ((int32_t)oscillation_amplitude * sine + 0x4000) >> 15;
+}
+
+void clear_waveform (uint16_t length)
+{
+	waveform_length = length;
+	waveform_upload_index = 0;
+}
+
+bool append_waveform_samples (int16_t *samples, uint8_t n_samples)
+{
+	if (waveform_upload_index + n_samples > WAVEFORM_SIZE)
+		return false;
+	
+	for (uint8_t i = 0; i < n_samples; i++)
+	{
+		waveform[waveform_upload_index++] = samples[i];
+	}
+	
+	return true;
+}
+
+uint16_t get_waveform_upload_index (void)
+{
+	return waveform_upload_index;
+}
+
+void update_waveform_sample_interval (uint16_t time_us)
+{
+	waveform_sample_interval_us = time_us >> 1;
+}
+
+void start_waveform (bool loop)
+{
+	if (waveform_length == 0)
+		return;
+	
+	oscillation = false;
+	waveform_loop = loop;
+	waveform_index = 0;
+	waveform_done = false;
+	waveform_playing = true;
+	velocity_mode = true;
+	velocity_stop = false;
+	
+	load_waveform_sample(waveform[waveform_index++]);
+	
+	/* The period generator starts on the first sample fast enough */
+	if (m_step_generator == GM_GENERATOR_DDS)
+	{
+		start_velocity_timer();
+	}
+	
+	timer_type0_enable(&TCE0, TIMER_PRESCALER_DIV64, waveform_sample_interval_us, INT_LEVEL_MED);
+}
+
+void start_oscillation (uint16_t amplitude, uint16_t frequency_mhz, uint16_t phase, uint16_t cycles)
+{
+	/* Phase increment for each sample, with the whole cycle being 2^32 */
+	/* f * dt * 2^32, with 10^9 / 2^9 = 1953125 to avoid the overflow */
+	oscillation_phase_increment = (((uint64_t)frequency_mhz * ((uint32_t)waveform_sample_interval_us << 1)) << 23) / 1953125;
+	oscillation_phase = (uint32_t)phase << 16;
+	oscillation_elapsed = 0;
+	oscillation_cycles = cycles;
+	oscillation_amplitude = amplitude;
+	
+	oscillation = true;
+	waveform_done = false;
+	waveform_playing = true;
+	velocity_mode = true;
+	velocity_stop = false;
+	
+	load_waveform_sample(oscillation_sample());
+	
+	/* The period generator starts on the first sample fast enough */
+	if (m_step_generator == GM_GENERATOR_DDS)
+	{
+		start_velocity_timer();
+	}
+	
+	timer_type0_enable(&TCE0, TIMER_PRESCALER_DIV64, waveform_sample_interval_us, INT_LEVEL_MED);
+}
+
+bool get_waveform_playing (void)
+{
+	return waveform_playing;
+}
+
+bool get_waveform_done (void)
+{
+	if (waveform_done)
+	{
+		waveform_done = false;
+		return true;
+	}
+	
+	return false;
+}
+
+static void end_waveform (void)
+{
+	/* Stop after the pulse in progress */
+	timer_type0_stop(&TCE0);
+	waveform_done = true;
+	velocity_stop = true;
+	
+	if (TCC0_CTRLA == 0)
+	{
+		stop_rotation();
+		send_motor_stopped_notification = true;
+	}
+}
+
+ISR(TCE0_OVF_vect/*, ISR_NAKED*/)
+{
+	step_isr_sequence++;
+	
+	if (hardware_cruise)
+	{
+		end_hardware_cruise();
+		return;
+	}
+	
+	if (oscillation)
+	{
+		oscillation_phase += oscillation_phase_increment;
+		oscillation_elapsed += oscillation_phase_increment;
+		
+		/* A whole cycle was completed when the elapsed phase wraps around */
+		if (oscillation_elapsed < oscillation_phase_increment)
+		{
+			if (oscillation_cycles && --oscillation_cycles == 0)
+			{
+				end_waveform();
+				return;
+			}
+		}
+		
+		load_waveform_sample(oscillation_sample());
+		return;
+	}
+	
+	if (waveform_index == waveform_length)
+	{
+		if (waveform_loop)
+		{
+			waveform_index = 0;
+		}
+		else
+		{
+			end_waveform();
+			return;
+		}
+	}
+	
+	load_waveform_sample(waveform[waveform_index++]);
+}
+
+/************************************************************************/
+/* Immediate pulses                                                     */
+/************************************************************************/
+/* The immediate pulses run without interrupts. A new interval goes to  */
+/* the PER and CCA buffers and TCC0 applies it at the next overflow.    */
+/* TCC0 runs with the smallest prescaler that fits the interval, like   */
+/* the ramped moves, and a new interval that needs another prescaler    */
+/* restarts the period. The pulses are counted by the hardware step     */
+/* counter and added to the position when it's read.                    */
+bool immediate_mode = false;
+uint16_t immediate_pulses_counted;
+
+static void count_immediate_pulses (void)
+{
+	uint16_t pulses = TCE0_CNT - immediate_pulses_counted;
+	
+	immediate_pulses_counted += pulses;
+	
+	/* The direction pin is cleared when moving positive */
+	if (read_MOTOR_DIRECTION)
+		motor_position -= pulses;
+	else
+		motor_position += pulses;
+}
+
+void set_immediate_pulses (int16_t interval_us)
+{
+	uint16_t interval_abs = (interval_us > 0) ? interval_us : -interval_us;
+	uint8_t i = prescaler_index(interval_abs);
+	uint8_t prescaler = TIMER_PRESCALER_DIV1 + i;
+	uint16_t interval = ((uint32_t)interval_abs << 5) >> prescaler_shift[i];
+	
+	/* The pulses already sent belong to the previous direction */
+	if (immediate_mode)
+		count_immediate_pulses();
+	else if (TCC0_CTRLA)
+		stop_rotation();
+	
+	if (interval_us > 0)
+		set_MOTOR_DIRECTION;
+	else
+		clr_MOTOR_DIRECTION;
+	
+	/* The same prescaler keeps the current period, another one restarts it */
+	if (immediate_mode && TCC0_CTRLA == prescaler)
+	{
+		TCC0_PERBUF = interval - 1;
+		TCC0_CCABUF = interval >> 1;
+	
+		return;
+	}
+	
+	if (!immediate_mode)
+	{
+		immediate_mode = true;
+		immediate_pulses_counted = 0;
+	
+		start_step_counter(0xFFFF, INT_LEVEL_OFF);
+	}
+	
+	timer_type0_pwm(&TCC0, prescaler, interval - 1, interval >> 1, INT_LEVEL_OFF, INT_LEVEL_OFF);
+}
+
+bool get_immediate_mode (void)
+{
+	return immediate_mode;
+}
+
+/************************************************************************/
+/* Scheduled start                                                      */
+/************************************************************************/
+/* The next move or waveform can wait for a Harp timestamp. TCC1, the   */
+/* timestamp counter of the core, counts the second in 32 us ticks and  */
+/* its compare B, unused by the core, starts the motion at that tick.   */
+/* The steps requested meanwhile wait in the mailbox.                   */
+uint8_t scheduled_start = SCHEDULE_OFF;
+uint32_t scheduled_second;
+uint16_t scheduled_tick;
+
+bool scheduled_loop;
+uint16_t scheduled_oscillation[4];
+
+bool scheduled_start_fired = false;
+
+static void read_harp_time (uint32_t *second, uint16_t *tick)
+{
+	do
+	{
+		*second = core_func_read_R_TIMESTAMP_SECOND();
+		*tick = TCC1_CNT;
+	} while (*second != core_func_read_R_TIMESTAMP_SECOND());
+	
+	/* The counter wrapped but the core didn't count the new second yet */
+	if ((TCC1_INTFLAGS & TC1_OVFIF_bm) && *tick < HARP_TICKS_PER_SECOND / 2)
+		(*second)++;
+}
+
+uint32_t get_harp_ticks (void)
+{
+	uint32_t second;
+	uint16_t tick;
+	
+	/* Wraps around, only for time differences */
+	read_harp_time(&second, &tick);
+	
+	return second * HARP_TICKS_PER_SECOND + tick;
+}
+
+bool schedule_start (uint32_t second, uint32_t microsecond)
+{
+	uint32_t now_second;
+	uint16_t now_tick;
+	uint16_t tick = microsecond >> 5;		// 32 us ticks
+	
+	if (microsecond > 999999)
+		return false;
+	
+	/* Leave enough time to arm the compare before the time arrives */
+	read_harp_time(&now_second, &now_tick);
+	
+	if (second < now_second || (second == now_second && tick < now_tick + SCHEDULED_START_MIN_TICKS))
+		return false;
+	
+	if (second == now_second + 1 && tick + HARP_TICKS_PER_SECOND < now_tick + SCHEDULED_START_MIN_TICKS)
+		return false;
+	
+	scheduled_second = second;
+	scheduled_tick = tick;
+	scheduled_start = SCHEDULE_ARMED;
+	
+	TCC1_CCB = tick;
+	TCC1_INTFLAGS = TC1_CCBIF_bm;
+	TCC1_INTCTRLB = (TCC1_INTCTRLB & ~TC1_CCBINTLVL_gm) | TC_CCBINTLVL_MED_gc;
+	
+	return true;
+}
+
+void cancel_scheduled_start (void)
+{
+	TCC1_INTCTRLB &= ~TC1_CCBINTLVL_gm;
+	
+	/* Discard the steps that waited for it, nothing else takes them */
+	if (scheduled_start && !motor_is_running)
+		mailbox_take();
+	
+	scheduled_start = SCHEDULE_OFF;
+}
+
+uint8_t get_scheduled_start (void)
+{
+	return scheduled_start;
+}
+
+bool schedule_waveform (bool loop)
 {
-	m_min_pulse_interval_us = time_us >> 1;
+	if (scheduled_start != SCHEDULE_ARMED || mailbox_pending() || segment_queue_count)
+		return false;
 	
-	ramp_steps = (m_max_pulse_interval_us - m_min_pulse_interval_us) / m_pulse_step_interval_us;
+	scheduled_loop = loop;
+	scheduled_start = SCHEDULE_WAVEFORM;
+	
+	return true;
 }
 
-void update_initial_pulse_interval (uint16_t time_us)
+bool schedule_oscillation (uint16_t amplitude, uint16_t frequency_mhz, uint16_t phase, uint16_t cycles)
 {
-	m_max_pulse_interval_us = time_us >> 1;
+	if (scheduled_start != SCHEDULE_ARMED || mailbox_pending() || segment_queue_count)
+		return false;
+	
+	scheduled_oscillation[0] = amplitude;
+	scheduled_oscillation[1] = frequency_mhz;
+	scheduled_oscillation[2] = phase;
+	scheduled_oscillation[3] = cycles;
+	scheduled_start = SCHEDULE_OSCILLATION;
 	
-	ramp_steps = (m_max_pulse_interval_us - m_min_pulse_interval_us) / m_pulse_step_interval_us;
+	return true;
 }
 
-void update_pulse_step_interval (uint16_t time_us)
+bool get_scheduled_start_fired (uint32_t *second, uint16_t *tick)
 {
-	m_pulse_step_interval_us = time_us >> 1;
+	if (scheduled_start_fired)
+	{
+		scheduled_start_fired = false;
+		*second = scheduled_second;
+		*tick = scheduled_tick;
+		return true;
+	}
 	
-	ramp_steps = (m_max_pulse_interval_us - m_min_pulse_interval_us) / m_pulse_step_interval_us;
+	return false;
 }
 
-void update_pulse_period (uint16_t time_us)
+ISR(TCC1_CCB_vect/*, ISR_NAKED*/)
 {
-	m_pulse_period_us = time_us >> 1;
+	uint32_t second = core_func_read_R_TIMESTAMP_SECOND();
+	uint8_t start = scheduled_start;
+	int32_t steps;
+	
+	/* The counter wrapped but the core didn't count the new second yet */
+	if ((TCC1_INTFLAGS & TC1_OVFIF_bm) && scheduled_tick < HARP_TICKS_PER_SECOND / 2)
+		second++;
+	
+	/* The compare matches once every second */
+	if (second < scheduled_second)
+		return;
+	
+	/* For the reads of get_final_motor_position() */
+	step_isr_sequence++;
+	
+	steps = mailbox_take();
+	cancel_scheduled_start();
+	
+	switch (start)
+	{
+		case SCHEDULE_WAVEFORM:
+			start_waveform(scheduled_loop);
+			break;
+		
+		case SCHEDULE_OSCILLATION:
+			start_oscillation(scheduled_oscillation[0], scheduled_oscillation[1], scheduled_oscillation[2], scheduled_oscillation[3]);
+			break;
+		
+		default:
+			if (steps)
+				start_rotation(steps);
+			else if (segment_queue_count)
+				start_queued_segments();
+			else
+				return;
+			break;
+	}
 	
-	ramp_steps = (m_max_pulse_interval_us - m_min_pulse_interval_us) / m_pulse_step_interval_us;
+	scheduled_start_fired = true;
 }
 
-/************************************************************************/
-/* Globals                                                              */
-/************************************************************************/
-uint16_t motor_target;
-uint16_t remaining;
-
-uint32_t steps_target;
-uint32_t steps_count;
-uint32_t steps_remaining;
-
-bool motor_is_running = false;
-bool moving_positive;
-bool decreasing_speed;
-
 /************************************************************************/
 /* Functions                                                            */
 /************************************************************************/
+static void start_pulses (void)
+{
+	motor_is_running = true;	// Update global with motor state
+	hardware_cruise_blocked = false;
+	
+	/* A table staged at the end of the last move */
+	if (ramp_staged)
+	{
+		use_staged_ramp_table();
+		ramp_seek(0);
+	}
+	
+	ramp_timer_pending = false;
+	
+	/* The periods of a trace must share the same time base */
+	if (step_trace_enabled && step_trace_prescaler != ramp_prescaler)
+		set_step_trace(true);
+	
+	/* Start the generation of pulses */
+	timer_type0_pwm(&TCC0, ramp_prescaler, ramp_table[0] - 1, ramp_pulse_width, INT_LEVEL_MED, INT_LEVEL_MED);
+}
+
 void start_rotation (int32_t requested_steps)
 {
 	if (requested_steps > 0)
@@ -79,148 +1976,553 @@ void start_rotation (int32_t requested_steps)
 	
 	steps_count = 0;				// Reset steps counter
 	steps_remaining = 0;			// Reset remaining steps
+	ramp_seek(0);				// Start from the beginning of the ramp
+	ramp_limit = ramp_cruise;	// Cruise at the nominal speed
+	cruise_interval_us = 0;
 	//TCD1_CNT = 0x8000;			// Reset encoder
 	
 	decreasing_speed = false;	// Reset decreasing speed flag
-	motor_is_running = true;	// Update global with motor state
 	
-	/* Start the generation of pulses */
-	timer_type0_pwm(&TCC0, TIMER_PRESCALER_DIV64, m_max_pulse_interval_us, m_pulse_period_us, INT_LEVEL_MED, INT_LEVEL_MED);
+	plan_profile(0);
+	
+	start_pulses();
+}
+
+void start_queued_segments (void)
+{
+	/* The scheduled start takes the segments when its time arrives */
+	if (segment_queue_count == 0 || scheduled_start)
+		return;
+	
+	load_queued_run();
+	
+	start_pulses();
 }
 
 void stop_rotation (void)
 {
+	/* Also called from the low levels, the step and start ISRs can't run after this */
+	TCC0_INTCTRLA = INT_LEVEL_OFF;
+	TCC0_INTCTRLB = INT_LEVEL_OFF;
+	TCE0_INTCTRLA = INT_LEVEL_OFF;
+	TCC1_INTCTRLB &= ~TC1_CCBINTLVL_gm;
+	
 	timer_type0_stop(&TCC0);
 	motor_is_running = false;
+	reversal_steps = 0;
+	velocity_mode = false;
+	
+	if (waveform_playing)
+	{
+		timer_type0_stop(&TCE0);
+		waveform_playing = false;
+	}
+	
+	if (immediate_mode)
+	{
+		count_immediate_pulses();
+		timer_type0_stop(&TCE0);
+		immediate_mode = false;
+	}
+	
+	if (hardware_cruise)
+	{
+		if (moving_positive)
+			motor_position += hardware_cruise_steps();
+		else
+			motor_position -= hardware_cruise_steps();
+		
+		timer_type0_stop(&TCE0);
+		hardware_cruise = false;
+	}
+	
+	hardware_cruise_blocked = false;
+	
+	/* Discard the request not yet taken */
+	mailbox_take();
+	
+	/* Discard the scheduled start */
+	cancel_scheduled_start();
+	
+	/* Discard the pending segments */
+	segment_queue_head = segment_queue_tail;
+	segment_queue_count = 0;
+	run_segments = 0;
 }
 
-int32_t user_sent_request (int32_t requested_steps)
+void set_motor_position (int32_t position)
 {
-	if (!motor_is_running)
+	motor_position = position;
+	position_correction = 0;
+	
+	closed_loop_anchor = motor_position;
+	closed_loop_anchor_correction = 0;
+	closed_loop_counts = 0;
+	closed_loop_integral = 0;
+}
+
+static int32_t current_motor_position (void)
+{
+	uint8_t sequence;
+	int32_t position;
+	
+	if (immediate_mode)
+		count_immediate_pulses();
+	
+	/* Read again if a step ISR ran meanwhile */
+	do
 	{
-		start_rotation(requested_steps);
+		sequence = step_isr_sequence;
+		position = motor_position;
+		
+		if (hardware_cruise)
+			position = (moving_positive) ? position + hardware_cruise_steps() : position - hardware_cruise_steps();
+	} while (sequence != step_isr_sequence);
+	
+	return position;
+}
+
+int32_t get_motor_position (void)
+{
+	/* The steps added by the closed loop are not part of the commanded position */
+	return current_motor_position() - position_correction;
+}
+
+int32_t get_final_motor_position (void)
+{
+	uint8_t sequence;
+	int32_t position;
+	
+	/* Read again if a step ISR or the scheduled start ran meanwhile */
+	do
+	{
+		sequence = step_isr_sequence;
+		
+		/* The requests not yet taken by the step ISR are part of the move */
+		/* The steps waiting for the scheduled start are part of the move */
+		position = mailbox_peek() - position_correction;
+		
+		if (motor_is_running == false)
+		{
+			position += current_motor_position();
+		}
+		else
+		{
+			/* The pulses of a hardware cruise are missing from both motor_position and steps_count */
+			/* Position where the current move will end */
+			if (moving_positive)
+				position += motor_position + (int32_t)(steps_target - steps_count) - (int32_t)reversal_steps;
+			else
+				position += motor_position - (int32_t)(steps_target - steps_count) + (int32_t)reversal_steps;
+		}
+	} while (sequence != step_isr_sequence);
+	
+	return position;
+}
+
+/************************************************************************/
+/* Closed loop                                                          */
+/************************************************************************/
+/* The encoder counts are converted to steps with m_steps_per_count,    */
+/* which has 8 fractional bits. The error is the number of pulses sent  */
+/* that the encoder didn't see, minus the corrections already sent.     */
+void update_steps_per_count (int16_t steps_per_count)
+{
+	m_steps_per_count = steps_per_count;
+}
+
+void update_closed_loop_gains (uint16_t kp, uint16_t ki)
+{
+	m_closed_loop_kp = kp;
+	m_closed_loop_ki = ki;
+}
+
+void reset_closed_loop (int16_t encoder)
+{
+	/* Start counting from here, motor_position belongs to the step ISRs */
+	closed_loop_anchor = current_motor_position();
+	closed_loop_anchor_correction = position_correction;
+	closed_loop_counts = 0;
+	closed_loop_previous_encoder = encoder;
+	closed_loop_integral = 0;
+	closed_loop_error = 0;
+}
+
+void set_closed_loop (bool enable, int16_t encoder)
+{
+	if (enable && !closed_loop)
+	{
+		reset_closed_loop(encoder);
+	}
+	
+	closed_loop = enable;
+}
+
+int32_t update_closed_loop (int16_t encoder)
+{
+	int32_t measured_steps;
+	int32_t error;
+	int32_t correction;
+	int32_t deadband;
+	
+	if (closed_loop == false)
+		return 0;
+	
+	/* Extend the 16 bits encoder to 32 bits */
+	closed_loop_counts += (int16_t)(encoder - closed_loop_previous_encoder);
+	closed_loop_previous_encoder = encoder;
+	
+	measured_steps = ((int64_t)closed_loop_counts * m_steps_per_count) >> 8;
+	closed_loop_error = (current_motor_position() - closed_loop_anchor) - (position_correction - closed_loop_anchor_correction) - measured_steps;
+	
+	/* Only correct the moves that accept new steps */
+	if (velocity_mode || segment_queue_count)
+		return 0;
+	
+	if (immediate_mode)
+		return 0;
+	
+	error = closed_loop_error;
+	
+	/* Errors within one encoder count can't be seen, the integral is frozen there */
+	deadband = ((m_steps_per_count > 0) ? (int32_t)m_steps_per_count : -(int32_t)m_steps_per_count) >> 8;
+	
+	if (deadband == 0)
+		deadband = 1;
+	
+	if (error <= deadband && error >= -deadband)
 		return 0;
+	
+	if (error > CLOSED_LOOP_ERROR_LIMIT) error = CLOSED_LOOP_ERROR_LIMIT;
+	if (error < -CLOSED_LOOP_ERROR_LIMIT) error = -CLOSED_LOOP_ERROR_LIMIT;
+	
+	closed_loop_integral += error;
+	
+	if (closed_loop_integral > CLOSED_LOOP_ERROR_LIMIT) closed_loop_integral = CLOSED_LOOP_ERROR_LIMIT;
+	if (closed_loop_integral < -CLOSED_LOOP_ERROR_LIMIT) closed_loop_integral = -CLOSED_LOOP_ERROR_LIMIT;
+	
+	/* PI with 8 fractional bits on the gains */
+	correction = ((int32_t)m_closed_loop_kp * error + (int32_t)m_closed_loop_ki * closed_loop_integral + 128) >> 8;
+	
+	position_correction += correction;
+	
+	return correction;
+}
+
+int32_t get_position_error (void)
+{
+	return closed_loop_error;
+}
+
+void user_sent_request (int32_t requested_steps)
+{
+	/* Nothing to post */
+	if (requested_steps == 0)
+		return;
+	
+	/* Waits for the scheduled start, the ramp being built, or for the next pulse of the move */
+	if (!motor_is_running && !scheduled_start && !get_ramp_building())
+	{
+		start_rotation(requested_steps);
+		return;
 	}
-	else
+	
+	mailbox_post(requested_steps);
+	
+	/* The step ISR is back within one pulse to take it */
+	request_hardware_cruise_end();
+	
+	/* The move ended before the request was posted */
+	if (!motor_is_running && !scheduled_start && !get_ramp_building() && mailbox_pending())
+		start_rotation(mailbox_take());
+}
+
+/* The overflow of the ramped moves only steps along the ramp and loads */
+/* the period of the next pulse. The compare, with the rest of the      */
+/* period left before the overflow that applies them, takes the         */
+/* requests, the segments and the ramp changes and plans the profile.   */
+/* It only runs at the next step where one of them is due: the end of   */
+/* the move or of the segment, or the end of the acceleration that may  */
+/* start the hardware cruise. Otherwise the overflow runs alone.        */
+static void plan_step_compare (void)
+{
+	compare_step = steps_target;
+	
+	if (run_segments && segment_end < compare_step)
+		compare_step = segment_end;
+	
+	if (m_hardware_cruise && steps_count <= accel_end_step && accel_end_step + 1 < compare_step)
+		compare_step = accel_end_step + 1;
+	
+	TCC0_INTCTRLB = INT_LEVEL_OFF;
+	
+	/* Posted while this compare was running */
+	if (mailbox_pending() || ramp_staged)
+		request_step_compare();
+}
+
+static inline void step_overflow (void)
+{	
+	uint16_t index;
+	
+	if (velocity_mode)
+		take_velocity_update();
+	
+	if (velocity_mode && m_step_generator == GM_GENERATOR_DDS)
 	{
-		if ((requested_steps > 0) && (moving_positive == true))
-		{			
-			steps_target += requested_steps;
-			return 0;
-		}
+		uint32_t phase = dds_phase;
 		
-		if ((requested_steps < 0) && (moving_positive == false))
+		/* The pulse scheduled on the previous tick has just started */
+		if (dds_pulse)
 		{
-			steps_target += (uint32_t)(~requested_steps + 1);
-			return 0;
+			if (moving_positive)
+				motor_position++;
+			else
+				motor_position--;
 		}
-		
-		if ((requested_steps > 0) && (moving_positive == false))
+		else
 		{
-			if (decreasing_speed)
-			{
-				return requested_steps;
-			}
-			else if (steps_count <= ramp_steps)
+			if (velocity_stop)
 			{
-				return requested_steps;
+				stop_rotation();
+				send_motor_stopped_notification = true;
+				return;
 			}
-			else
+			
+			/* Turn around on a tick without pulse */
+			/* The fraction of step already done now counts backwards */
+			if (velocity_positive != moving_positive)
 			{
-				uint32_t available_steps_to_decrease = steps_remaining - ramp_steps - 1;
-				
-				if (requested_steps <= available_steps_to_decrease)
-				{
-					steps_target -= requested_steps;
-					return 0;
-				}
+				if (velocity_positive)
+					set_MOTOR_DIRECTION;
 				else
-				{
-					steps_target -= available_steps_to_decrease;
-					return requested_steps - available_steps_to_decrease;
-				}
+					clr_MOTOR_DIRECTION;
+				
+				moving_positive = velocity_positive;
+				dds_phase = -dds_phase;
+				phase = dds_phase;
 			}
 		}
 		
-		if ((requested_steps < 0) && (moving_positive == true))
-		{
-			if (decreasing_speed)
-			{
-				return requested_steps;
-		}
-		else if (steps_count <= ramp_steps)
+		/* Schedule a pulse for the next tick when the phase wraps around */
+		dds_pulse = false;
+		
+		if (velocity_positive == moving_positive)
 		{
-			return requested_steps;
-		}
-			else
-			{
-				uint32_t available_steps_to_decrease = steps_remaining - ramp_steps - 1;
-				
-				if ((~requested_steps+1) <= available_steps_to_decrease)
-				{
-					steps_target -= (uint32_t)(~requested_steps + 1);
-					return 0;
-				}
-				else
-				{
-					steps_target -= available_steps_to_decrease;
-					return requested_steps + available_steps_to_decrease;
-				}
-			}
+			dds_phase += dds_increment;
+			dds_pulse = (dds_phase < phase);
 		}
+		
+		TCC0_CCABUF = (dds_pulse) ? dds_pulse_width : 0;
+		
+		return;
 	}
-}
-
-ISR(TCC0_OVF_vect/*, ISR_NAKED*/)
-{	
-	if (TCC0_INTCTRLB == 0)
+	
+	if (velocity_mode)
 	{
-		TCC0_PER = (app_regs.REG_IMMEDIATE_PULSES >> 1) - 1;
-		TCC0_CCA = app_regs.REG_IMMEDIATE_PULSES >> 2;
+		if (moving_positive)
+			motor_position++;
+		else
+			motor_position--;
+		
+		TCC0_PER = velocity_period;
 		
 		return;
 	}
 	
-	remaining = motor_target - steps_count;
+	/* A cruise cut short by request_hardware_cruise_end(), no pulse ended here */
+	if (hardware_cruise)
+	{
+		cut_hardware_cruise();
+		return;
+	}
 	
+	/* Period of the step that just ended */
+	if (step_trace_enabled)
+		record_step_trace(TCC0_PER + 1);
 	
 	steps_count++;
 	
-	steps_remaining = steps_target - steps_count; 
-		
-	if ((steps_remaining <= steps_count) && (steps_remaining <= ramp_steps))
-	{		
+	if (moving_positive)
+		motor_position++;
+	else
+		motor_position--;
+	
+	if (steps_count == compare_step)
+		request_step_compare();
+	
+	/* The compare of the last pulse changed the ramp */
+	if (ramp_timer_pending)
+		load_ramp_timer();
+	
+	steps_remaining = steps_target - steps_count;
+	
+	if (steps_count >= decel_start_step)
+	{
 		decreasing_speed = true;
 		
-		/* Decrease motor speed */
-		if (TCC0_PER < m_max_pulse_interval_us)
-		{
-			TCC0_PER = (TCC0_PER + m_pulse_step_interval_us > m_max_pulse_interval_us)? m_max_pulse_interval_us : TCC0_PER + m_pulse_step_interval_us;
-		}
+		/* Decrease motor speed, the step n from the end runs at the ramp index n */
+		index = (steps_remaining) ? steps_remaining - 1 : 0;
+		
+		if (index + 1 == ramp_index)
+			ramp_step_down();
+		else if (index != ramp_index)
+			ramp_seek(index);
 	}
-	else
+	else if (steps_count <= accel_end_step)
 	{
 		decreasing_speed = false;
 		
-		/* Increase motor speed */
-		if (TCC0_PER > m_min_pulse_interval_us)
-		{
-			TCC0_PER = (TCC0_PER - m_pulse_step_interval_us < m_min_pulse_interval_us)? m_min_pulse_interval_us : TCC0_PER - m_pulse_step_interval_us;
-		}	
+		/* Increase motor speed, or slow down to the cruise speed of the segment */
+		if (ramp_index < ramp_limit)
+			ramp_step_up();
+		else
+			ramp_step_down();
+	}
+	else
+	{
+		decreasing_speed = false;
 	}
+	
+	TCC0_PER = ramp_ticks() - 1;
 }
 
-bool send_motor_stopped_notification = false;
-
-ISR(TCC0_CCA_vect/*, ISR_NAKED*/)
+static inline void step_compare (void)
 {		
-	if (steps_count == steps_target)
+	if (velocity_mode)
 	{
-		/* Stop motor */
-		stop_rotation();
+		if (velocity_stop)
+		{
+			stop_rotation();
+			send_motor_stopped_notification = true;
+		}
+		else if (waveform_playing && waveform_pause)
+		{
+			/* Pause the pulses until the next sample that is fast enough */
+			timer_type0_stop(&TCC0);
+		}
+		else if (velocity_positive != moving_positive)
+		{
+			/* Turn around between two pulses */
+			if (velocity_positive)
+				set_MOTOR_DIRECTION;
+			else
+				clr_MOTOR_DIRECTION;
+			
+			moving_positive = velocity_positive;
+		}
 		
-		/* Since this is used at MID level interrupts, send an event from here can happen in the middle of other event */
-		send_motor_stopped_notification = true;
+		return;
+	}
+	
+	/* Move on to the next segment of the same move */
+	if (run_segments && (steps_count == segment_end))
+	{
+		segment_end += segment_steps(&segment_queue[segment_queue_head]);
+		cruise_interval_us = segment_queue[segment_queue_head].period;
+		ramp_limit = ramp_index_for_period(us_to_ramp_ticks(cruise_interval_us));
+		pop_segment();
+		run_segments--;
+		
+		plan_profile(steps_count);
+	}
+	
+	/* Apply the new request from the next pulse, it may extend the move */
+	if (mailbox_pending())
+		take_steps_request();
+	
+	if (steps_count == steps_target)
+	{
+		if (reversal_steps)
+		{
+			/* Reverse the direction between two pulses and accelerate again */
+			if (moving_positive)
+			{
+				clr_MOTOR_DIRECTION;
+				moving_positive = false;
+			}
+			else
+			{
+				set_MOTOR_DIRECTION;
+				moving_positive = true;
+			}
+			
+			steps_target = reversal_steps;
+			reversal_steps = 0;
+			
+			steps_count = 0;
+			steps_remaining = 0;
+			ramp_seek(0);
+			ramp_limit = ramp_cruise;
+			cruise_interval_us = 0;
+			decreasing_speed = false;
+			
+			plan_profile(0);
+			
+			TCC0_PER = ramp_table[0] - 1;
+		}
+		else if (segment_queue_count)
+		{
+			/* Start the next queued move without stopping the timer */
+			/* The direction is changed between two pulses */
+			load_queued_run();
+			
+			TCC0_PER = ramp_table[0] - 1;
+		}
+		else
+		{
+			/* Stop motor */
+			stop_rotation();
+			
+			/* Since this is used at MID level interrupts, send an event from here can happen in the middle of other event */
+			send_motor_stopped_notification = true;
+		}
+	}
+	
+	if (motor_is_running == false)
+		return;
+	
+	/* New ramp parameters apply from the next pulse */
+	/* Once stopped, the next start takes the staged table */
+	if (ramp_staged)
+		change_ramp_table();
+	
+	/* Leave the cruise until the deceleration to the hardware counter */
+	/* The traced moves keep the step ISR running */
+	if (m_hardware_cruise && steps_count > accel_end_step && steps_count < decel_start_step)
+	{
+		if (run_segments == 0 && reversal_steps == 0 && !hardware_cruise_blocked && !step_trace_enabled)
+		{
+			if (decel_start_step - steps_count > HARDWARE_CRUISE_MIN_STEPS)
+				start_hardware_cruise(decel_start_step - steps_count);
+		}
 	}
+	
+	/* The cruise turns the compare on again when it ends */
+	if (hardware_cruise == false)
+		plan_step_compare();
+}
+
+ISR(TCC0_OVF_vect/*, ISR_NAKED*/)
+{
+	ISR_ENTER(ISR_TCC0_OVF);
+	ISR_LATENCY(ISR_TCC0_OVF, TCC0_CNT);
+	
+	step_isr_sequence++;
+	step_overflow();
+	
+	ISR_STEP_PERIOD_CHECK();
+	ISR_EXIT(ISR_TCC0_OVF);
+}
+
+ISR(TCC0_CCA_vect/*, ISR_NAKED*/)
+{
+	ISR_ENTER(ISR_TCC0_CCA);
+	ISR_LATENCY(ISR_TCC0_CCA, TCC0_CNT - TCC0_CCA);
+	
+	step_isr_sequence++;
+	step_compare();
+	
+	ISR_EXIT(ISR_TCC0_CCA);
 }
 
@@ -11,14 +11,97 @@
 	#define false 0
 #endif
 
-void update_nominal_pulse_interval (uint16_t time_us);
-void update_initial_pulse_interval (uint16_t time_us);
+#define RAMP_TABLE_SIZE 256
+#define RAMP_MAX_STEPS 0xFF00		// Last entry of the table with 256 steps per entry
+#define RAMP_MIN_TICKS 50			// Nominal interval within 2 % at the prescaler of the initial one
+#define SEGMENT_QUEUE_SIZE 8		// Must be a power of 2
+#define CLOSED_LOOP_ERROR_LIMIT 0x7FFF
+#define HARDWARE_CRUISE_MIN_STEPS 16
+#define STEP_TRACE_SIZE 256			// Must be a power of 2
+#define STEP_TRACE_DECREASING (1UL << 24)
+#define HARP_TICKS_PER_SECOND 31250	// Ticks of TCC1, the timestamp counter of the core
+#define SCHEDULED_START_MIN_TICKS 32	// 1 ms
+#define WAVEFORM_SIZE 256
+#define WAVEFORM_MIN_VELOCITY 8	// Slowest speed in steps/s with a 16 bits period
+
+/* The tick rate can be set at build time, the host benchmark compares several */
+#ifndef DDS_TICK_RATE
+	#define DDS_TICK_RATE 25000		// Hz
+#endif
+#define DDS_TICK_PERIOD (32000000UL / DDS_TICK_RATE)
+#define DDS_VELOCITY_SCALE ((uint32_t)((0x100000000ULL + DDS_TICK_RATE / 2) / DDS_TICK_RATE))	// 2^32 / DDS_TICK_RATE
+
+void rebuild_ramp_table (void);
+void build_pending_ramp_table (void);
+bool get_ramp_building (void);
+bool check_ramp_intervals (uint32_t nominal_us, uint32_t initial_us);
+
+void update_nominal_pulse_interval (uint32_t time_us);
+void update_initial_pulse_interval (uint32_t time_us);
 void update_pulse_step_interval (uint16_t time_us);
 void update_pulse_period (uint16_t time_us);
+void update_profile_type (uint8_t profile_type);
+void update_acceleration (uint32_t acceleration);
+void update_jerk (uint32_t jerk);
+void update_motion_parameters (uint32_t nominal_us, uint32_t initial_us, uint16_t step_us, uint16_t period_us, uint8_t profile_type, uint32_t acceleration, uint32_t jerk);
 
 void start_rotation (int32_t requested_steps);
 void stop_rotation (void);
 
-int32_t user_sent_request (int32_t requested_steps);
+bool enqueue_motion_segment (int32_t steps, uint32_t time_us);
+uint8_t get_segment_queue_space (void);
+void start_queued_segments (void);
+
+void update_hardware_cruise (bool enable);
+
+void set_step_trace (bool enable);
+uint32_t get_step_trace_steps (void);
+void read_step_trace (uint16_t index, uint32_t *entries, uint8_t n_entries);
+
+void set_immediate_pulses (int16_t interval_us);
+bool get_immediate_mode (void);
+
+#define SCHEDULE_OFF 0
+#define SCHEDULE_ARMED 1
+#define SCHEDULE_WAVEFORM 2
+#define SCHEDULE_OSCILLATION 3
+
+bool schedule_start (uint32_t second, uint32_t microsecond);
+void cancel_scheduled_start (void);
+uint8_t get_scheduled_start (void);
+bool schedule_waveform (bool loop);
+bool schedule_oscillation (uint16_t amplitude, uint16_t frequency_mhz, uint16_t phase, uint16_t cycles);
+bool get_scheduled_start_fired (uint32_t *second, uint16_t *tick);
+uint32_t get_harp_ticks (void);
+
+void set_target_velocity (int16_t velocity);
+void set_velocity_acceleration (uint32_t acceleration);
+void update_velocity_mode (void);
+bool get_velocity_mode (void);
+bool get_ramped_move (void);
+bool get_move_waiting (void);
+void update_step_generator (uint8_t step_generator);
+
+void clear_waveform (uint16_t length);
+bool append_waveform_samples (int16_t *samples, uint8_t n_samples);
+uint16_t get_waveform_upload_index (void);
+void update_waveform_sample_interval (uint16_t time_us);
+void start_waveform (bool loop);
+void start_oscillation (uint16_t amplitude, uint16_t frequency_mhz, uint16_t phase, uint16_t cycles);
+bool get_waveform_playing (void);
+bool get_waveform_done (void);
+
+void set_motor_position (int32_t position);
+int32_t get_motor_position (void);
+int32_t get_final_motor_position (void);
+
+void update_steps_per_count (int16_t steps_per_count);
+void update_closed_loop_gains (uint16_t kp, uint16_t ki);
+void reset_closed_loop (int16_t encoder);
+void set_closed_loop (bool enable, int16_t encoder);
+int32_t update_closed_loop (int16_t encoder);
+int32_t get_position_error (void);
+
+void user_sent_request (int32_t requested_steps);
 
 #endif /* _STEPPER_MOTOR_H_ */
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef _MOCK_AVR_INTERRUPT_H_
+#define _MOCK_AVR_INTERRUPT_H_
+
+/* The interrupts are plain functions, called by mock_hardware.c */
+#define ISR(vector, ...) void vector (void)
+#define ISR_NAKED
+#define reti()
+#define sei()
+#define cli()
+
+#endif /* _MOCK_AVR_INTERRUPT_H_ */
@@ -0,0 +1,230 @@
+#ifndef _MOCK_AVR_IO_H_
+#define _MOCK_AVR_IO_H_
+#include <stdint.h>
+
+/************************************************************************/
+/* Host mock of the ATxmega32A4U registers used by the motion modules   */
+/************************************************************************/
+/* Only the registers and bits used by the firmware are declared. The   */
+/* peripherals are plain memory, tests/mock/mock_hardware.c makes them  */
+/* count and calls the interrupts, see mock_hardware.h.                 */
+typedef volatile uint8_t register8_t;
+typedef volatile uint16_t register16_t;
+
+typedef struct TC0_struct
+{
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t CTRLC;
+	register8_t CTRLD;
+	register8_t CTRLE;
+	register8_t INTCTRLA;
+	register8_t INTCTRLB;
+	register8_t CTRLFCLR;
+	register8_t CTRLFSET;
+	register8_t CTRLGCLR;
+	register8_t CTRLGSET;
+	register8_t INTFLAGS;
+	register16_t CNT;
+	register16_t PER;
+	register16_t CCA;
+	register16_t CCB;
+	register16_t CCC;
+	register16_t CCD;
+	register16_t PERBUF;
+	register16_t CCABUF;
+	register16_t CCBBUF;
+	register16_t CCCBUF;
+	register16_t CCDBUF;
+} TC0_t;
+
+typedef TC0_t TC1_t;
+
+typedef struct PORT_struct
+{
+	register8_t DIR;
+	register8_t OUT;
+	register8_t OUTSET;
+	register8_t OUTCLR;
+	register8_t OUTTGL;
+	register8_t IN;
+	register8_t INTCTRL;
+	register8_t INT0MASK;
+	register8_t INT1MASK;
+	register8_t INTFLAGS;
+} PORT_t;
+
+typedef struct DMA_CH_struct
+{
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t ADDRCTRL;
+	register8_t TRIGSRC;
+	register16_t TRFCNT;
+	register8_t REPCNT;
+	register8_t SRCADDR0;
+	register8_t SRCADDR1;
+	register8_t SRCADDR2;
+	register8_t DESTADDR0;
+	register8_t DESTADDR1;
+	register8_t DESTADDR2;
+} DMA_CH_t;
+
+typedef struct USART_struct
+{
+	register8_t DATA;
+	register8_t STATUS;
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t CTRLC;
+	register8_t BAUDCTRLA;
+	register8_t BAUDCTRLB;
+} USART_t;
+
+/* Only referenced by the prototypes of cpu.h */
+typedef struct ADC_struct
+{
+	register8_t CTRLA;
+} ADC_t;
+
+extern TC0_t TCC0, TCD0, TCE0;
+extern TC1_t TCC1, TCD1;
+extern PORT_t PORTB, PORTC, PORTD;
+extern DMA_CH_t DMA_CH3;
+extern USART_t USARTD0;
+extern register8_t DMA_CTRL, DMA_INTFLAGS;
+extern register8_t PMIC_CTRL;
+extern register8_t EVSYS_CH0MUX, EVSYS_CH0CTRL, EVSYS_CH2MUX, EVSYS_CH2CTRL;
+extern register8_t SREG;
+
+#define TCC0_CTRLA TCC0.CTRLA
+#define TCC0_CTRLB TCC0.CTRLB
+#define TCC0_CTRLD TCC0.CTRLD
+#define TCC0_INTCTRLA TCC0.INTCTRLA
+#define TCC0_INTCTRLB TCC0.INTCTRLB
+#define TCC0_CTRLFSET TCC0.CTRLFSET
+#define TCC0_INTFLAGS TCC0.INTFLAGS
+#define TCC0_CNT TCC0.CNT
+#define TCC0_PER TCC0.PER
+#define TCC0_CCA TCC0.CCA
+#define TCC0_CCB TCC0.CCB
+#define TCC0_PERBUF TCC0.PERBUF
+#define TCC0_CCABUF TCC0.CCABUF
+
+#define TCD0_CTRLA TCD0.CTRLA
+#define TCD0_INTCTRLA TCD0.INTCTRLA
+#define TCD0_INTFLAGS TCD0.INTFLAGS
+#define TCD0_CNT TCD0.CNT
+#define TCD0_PER TCD0.PER
+
+#define TCE0_CTRLA TCE0.CTRLA
+#define TCE0_INTCTRLA TCE0.INTCTRLA
+#define TCE0_CTRLFSET TCE0.CTRLFSET
+#define TCE0_INTFLAGS TCE0.INTFLAGS
+#define TCE0_CNT TCE0.CNT
+#define TCE0_PER TCE0.PER
+
+#define TCC1_CTRLA TCC1.CTRLA
+#define TCC1_INTCTRLA TCC1.INTCTRLA
+#define TCC1_INTCTRLB TCC1.INTCTRLB
+#define TCC1_INTFLAGS TCC1.INTFLAGS
+#define TCC1_CNT TCC1.CNT
+#define TCC1_PER TCC1.PER
+#define TCC1_CCA TCC1.CCA
+#define TCC1_CCB TCC1.CCB
+
+#define TCD1_CTRLA TCD1.CTRLA
+#define TCD1_CTRLD TCD1.CTRLD
+#define TCD1_CTRLFSET TCD1.CTRLFSET
+#define TCD1_CNT TCD1.CNT
+#define TCD1_PER TCD1.PER
+
+#define PORTC_INTCTRL PORTC.INTCTRL
+#define PORTC_INT0MASK PORTC.INT0MASK
+
+#define DMA_CH3_CTRLA DMA_CH3.CTRLA
+#define DMA_CH3_ADDRCTRL DMA_CH3.ADDRCTRL
+#define DMA_CH3_TRIGSRC DMA_CH3.TRIGSRC
+#define DMA_CH3_TRFCNT DMA_CH3.TRFCNT
+#define DMA_CH3_TRFCNTL (*(register8_t *)&DMA_CH3.TRFCNT)
+#define DMA_CH3_REPCNT DMA_CH3.REPCNT
+#define DMA_CH3_SRCADDR0 DMA_CH3.SRCADDR0
+#define DMA_CH3_SRCADDR1 DMA_CH3.SRCADDR1
+#define DMA_CH3_SRCADDR2 DMA_CH3.SRCADDR2
+#define DMA_CH3_DESTADDR0 DMA_CH3.DESTADDR0
+#define DMA_CH3_DESTADDR1 DMA_CH3.DESTADDR1
+#define DMA_CH3_DESTADDR2 DMA_CH3.DESTADDR2
+
+#define USARTD0_DATA USARTD0.DATA
+#define USARTD0_STATUS USARTD0.STATUS
+#define USARTD0_CTRLA USARTD0.CTRLA
+#define USARTD0_CTRLB USARTD0.CTRLB
+#define USARTD0_CTRLC USARTD0.CTRLC
+#define USARTD0_BAUDCTRLA USARTD0.BAUDCTRLA
+#define USARTD0_BAUDCTRLB USARTD0.BAUDCTRLB
+
+/* Timers */
+#define TC_CLKSEL_OFF_gc 0x00
+#define TC_CLKSEL_DIV1_gc 0x01
+#define TC_CLKSEL_DIV2_gc 0x02
+#define TC_CLKSEL_DIV4_gc 0x03
+#define TC_CLKSEL_DIV8_gc 0x04
+#define TC_CLKSEL_DIV64_gc 0x05
+#define TC_CLKSEL_DIV256_gc 0x06
+#define TC_CLKSEL_DIV1024_gc 0x07
+#define TC_CLKSEL_EVCH0_gc 0x08
+#define TC_CLKSEL_EVCH2_gc 0x0A
+#define TC_CMD_RESET_gc 0x0C
+#define TC_EVACT_QDEC_gc 0x60
+#define TC_EVSEL_CH0_gc 0x08
+#define TC0_CLKSEL_gm 0x0F
+#define TC1_CLKSEL_gm 0x0F
+#define TC0_OVFIF_bm 0x01
+#define TC0_CCAIF_bm 0x10
+#define TC1_OVFIF_bm 0x01
+#define TC1_CCAIF_bm 0x10
+#define TC1_CCBIF_bm 0x20
+#define TC1_CCBINTLVL_gm 0x0C
+#define TC_CCBINTLVL_OFF_gc 0x00
+#define TC_CCBINTLVL_LO_gc 0x04
+#define TC_CCBINTLVL_MED_gc 0x08
+#define TC_CCBINTLVL_HI_gc 0x0C
+
+/* Event system */
+#define EVSYS_CHMUX_PORTC_PIN4_gc 0x64
+#define EVSYS_CHMUX_TCC0_OVF_gc 0xC0
+#define EVSYS_QDEN_bm 0x08
+#define EVSYS_DIGFILT_2SAMPLES_gc 0x01
+
+/* Interrupt controller */
+#define PMIC_LOLVLEN_bm 0x01
+#define PMIC_MEDLVLEN_bm 0x02
+#define PMIC_HILVLEN_bm 0x04
+#define PMIC_RREN_bm 0x80
+
+/* Ports */
+#define PORT_INT0LVL_gm 0x03
+#define PORT_INT0LVL_LO_gc 0x01
+
+/* USART */
+#define USART_CMODE_ASYNCHRONOUS_gc 0x00
+#define USART_PMODE_DISABLED_gc 0x00
+#define USART_CHSIZE_8BIT_gc 0x03
+#define USART_RXEN_bm 0x10
+#define USART_CLK2X_bm 0x04
+#define USART_RXCINTLVL_gm 0x30
+
+/* DMA */
+#define DMA_ENABLE_bm 0x80
+#define DMA_CH_ENABLE_bm 0x80
+#define DMA_CH_REPEAT_bm 0x20
+#define DMA_CH_SINGLE_bm 0x04
+#define DMA_CH_BURSTLEN_1BYTE_gc 0x00
+#define DMA_CH_SRCRELOAD_NONE_gc 0x00
+#define DMA_CH_SRCDIR_FIXED_gc 0x00
+#define DMA_CH_DESTRELOAD_BLOCK_gc 0x08
+#define DMA_CH_DESTDIR_INC_gc 0x01
+#define DMA_CH_TRIGSRC_USARTD0_RXC_gc 0x6B
+#define DMA_CH3TRNIF_bm 0x08
+
+#endif /* _MOCK_AVR_IO_H_ */
@@ -0,0 +1,337 @@
+#include "mock_hardware.h"
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "stepper_motor.h"
+
+/************************************************************************/
+/* Registers                                                            */
+/************************************************************************/
+TC0_t TCC0, TCD0, TCE0;
+TC1_t TCC1, TCD1;
+PORT_t PORTB, PORTC, PORTD;
+DMA_CH_t DMA_CH3;
+USART_t USARTD0;
+register8_t DMA_CTRL, DMA_INTFLAGS;
+register8_t PMIC_CTRL;
+register8_t EVSYS_CH0MUX, EVSYS_CH0CTRL, EVSYS_CH2MUX, EVSYS_CH2CTRL;
+register8_t SREG;
+
+/* Defined in interrupts.c, which isn't built on the host */
+bool external_control_first_byte = true;
+
+/* Interrupts of the firmware */
+void TCC0_OVF_vect (void);
+void TCC0_CCA_vect (void);
+void TCE0_OVF_vect (void);
+void TCC1_CCB_vect (void);
+
+/************************************************************************/
+/* State                                                                */
+/************************************************************************/
+static const uint8_t clock_select_shift[] = {0, 0, 1, 2, 3, 6, 8, 10};
+
+int32_t mock_pulses;
+uint64_t mock_cycles;
+uint32_t mock_step_interrupts;
+uint32_t mock_harp_second;
+
+uint16_t mock_events;
+uint8_t mock_last_event;
+
+uint32_t mock_isr_blocks;
+uint32_t mock_isr_calls[MOCK_STEP_ISRS];
+uint32_t mock_isr_max_blocks[MOCK_STEP_ISRS];
+uint64_t mock_isr_total_blocks[MOCK_STEP_ISRS];
+
+static uint32_t harp_cycles;
+static uint32_t tce0_cycles;
+static uint16_t last_perbuf;
+static uint16_t last_ccabuf;
+
+void mock_reset (void)
+{
+	mock_pulses = 0;
+	mock_cycles = 0;
+	mock_step_interrupts = 0;
+	mock_harp_second = 1000;
+	mock_events = 0;
+	
+	for (uint8_t i = 0; i < MOCK_STEP_ISRS; i++)
+	{
+		mock_isr_calls[i] = 0;
+		mock_isr_max_blocks[i] = 0;
+		mock_isr_total_blocks[i] = 0;
+	}
+	
+	harp_cycles = 0;
+	tce0_cycles = 0;
+	
+	/* The Harp timestamp counter of the core, in 32 us ticks */
+	TCC1.CTRLA = TC_CLKSEL_DIV1024_gc;
+	TCC1.PER = HARP_TICKS_PER_SECOND - 1;
+	TCC1.CNT = 0;
+	
+	PMIC_CTRL = PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+}
+
+void mock_sync_ports (void)
+{
+	/* The firmware only writes OUTSET and OUTCLR */
+	PORT_t *ports[] = {&PORTB, &PORTC, &PORTD};
+	
+	for (uint8_t i = 0; i < sizeof(ports) / sizeof(ports[0]); i++)
+	{
+		ports[i]->OUT = (ports[i]->OUT | ports[i]->OUTSET) & ~ports[i]->OUTCLR;
+		ports[i]->OUTSET = 0;
+		ports[i]->OUTCLR = 0;
+		ports[i]->IN = (ports[i]->IN & ~ports[i]->DIR) | (ports[i]->OUT & ports[i]->DIR);
+	}
+}
+
+/************************************************************************/
+/* Timers                                                               */
+/************************************************************************/
+void timer_type0_enable (TC0_t* timer, uint8_t prescaler, uint16_t target_count, uint8_t int_level)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CNT = 0;
+	timer->INTFLAGS = 0;
+	timer->PER = target_count;
+	timer->INTCTRLA = int_level;
+	timer->INTCTRLB = INT_LEVEL_OFF;
+	timer->CTRLA = prescaler;
+	
+	if (timer == &TCE0)
+		tce0_cycles = 0;
+}
+
+void timer_type0_pwm (TC0_t* timer, uint8_t prescaler, uint16_t target_count, uint16_t duty_cycle_count, uint8_t int_level_ovf, uint8_t int_level_cca)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CNT = 0;
+	timer->INTFLAGS = 0;
+	timer->PER = target_count;
+	timer->CCA = duty_cycle_count;
+	timer->PERBUF = target_count;
+	timer->CCABUF = duty_cycle_count;
+	timer->INTCTRLA = int_level_ovf;
+	timer->INTCTRLB = int_level_cca;
+	timer->CTRLA = prescaler;
+	
+	if (timer == &TCC0)
+	{
+		last_perbuf = target_count;
+		last_ccabuf = duty_cycle_count;
+	}
+}
+
+void timer_type0_stop (TC0_t* timer)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CNT = 0;
+	timer->INTFLAGS = 0;
+}
+
+uint32_t mock_period_cycles (void)
+{
+	uint8_t clock_select = TCC0.CTRLA & TC0_CLKSEL_gm;
+	
+	if (clock_select == TC_CLKSEL_OFF_gc || clock_select > TC_CLKSEL_DIV1024_gc)
+		return 0;
+	
+	return ((uint32_t)TCC0.PER + 1) << clock_select_shift[clock_select];
+}
+
+static void run_step_isr (void (*vector)(void), uint8_t isr)
+{
+	uint32_t blocks = mock_isr_blocks;
+	
+	mock_step_interrupts++;
+	vector();
+	
+	blocks = mock_isr_blocks - blocks;
+	mock_isr_calls[isr]++;
+	mock_isr_total_blocks[isr] += blocks;
+	
+	if (blocks > mock_isr_max_blocks[isr])
+		mock_isr_max_blocks[isr] = blocks;
+}
+
+void mock_advance (uint32_t cycles)
+{
+	uint8_t clock_select;
+	
+	/* TCC1 counts the Harp time, the core counts the seconds */
+	harp_cycles += cycles;
+	
+	while (harp_cycles >= 1024)
+	{
+		harp_cycles -= 1024;
+	
+		if (TCC1.CNT == TCC1.PER)
+		{
+			TCC1.CNT = 0;
+			mock_harp_second++;
+		}
+		else
+		{
+			TCC1.CNT++;
+		}
+	
+		if (TCC1.CNT == TCC1.CCB && (TCC1.INTCTRLB & TC1_CCBINTLVL_gm))
+			TCC1_CCB_vect();
+	}
+	
+	/* TCE0 loads the waveform samples when it runs from the clock */
+	clock_select = TCE0.CTRLA & TC0_CLKSEL_gm;
+	
+	if (clock_select == TC_CLKSEL_OFF_gc || clock_select > TC_CLKSEL_DIV1024_gc)
+		return;
+	
+	tce0_cycles += cycles;
+	
+	while (tce0_cycles >= ((uint32_t)TCE0.PER + 1) << clock_select_shift[clock_select])
+	{
+		tce0_cycles -= ((uint32_t)TCE0.PER + 1) << clock_select_shift[clock_select];
+	
+		if (TCE0.INTCTRLA)
+		{
+			run_step_isr(TCE0_OVF_vect, MOCK_ISR_TCE0_OVF);
+		}
+	
+		clock_select = TCE0.CTRLA & TC0_CLKSEL_gm;
+	
+		if (clock_select == TC_CLKSEL_OFF_gc || clock_select > TC_CLKSEL_DIV1024_gc)
+			return;
+	}
+}
+
+void mock_main_loop (void)
+{
+	build_pending_ramp_table();
+}
+
+bool mock_run_period (void)
+{
+	uint32_t cycles;
+	
+	/* Between the interrupts */
+	mock_main_loop();
+	
+	cycles = mock_period_cycles();
+	
+	if (cycles == 0)
+		return false;
+	
+	mock_sync_ports();
+	
+	/* The pulse is high from the start of the period until CCA */
+	if (TCC0.CCA)
+	{
+		/* The direction pin is cleared when moving positive */
+		mock_pulses += (PORTC.OUT & (1 << 6)) ? -1 : 1;
+	}
+	
+	mock_cycles += cycles;
+	mock_advance(cycles);
+	
+	/* The overflow loads the buffers written since the last one */
+	if (TCC0.PERBUF != last_perbuf)
+	{
+		last_perbuf = TCC0.PERBUF;
+		TCC0.PER = last_perbuf;
+	}
+	
+	if (TCC0.CCABUF != last_ccabuf)
+	{
+		last_ccabuf = TCC0.CCABUF;
+		TCC0.CCA = last_ccabuf;
+	}
+	
+	TCC0.INTFLAGS |= TC0_OVFIF_bm;
+	
+	/* TCE0 counts the overflows through the event channel 2 */
+	if ((TCE0.CTRLA & TC0_CLKSEL_gm) == TC_CLKSEL_EVCH2_gc && EVSYS_CH2MUX == EVSYS_CHMUX_TCC0_OVF_gc)
+	{
+		if (TCE0.CNT == TCE0.PER)
+		{
+			TCE0.CNT = 0;
+			TCE0.INTFLAGS |= TC0_OVFIF_bm;
+		}
+		else
+		{
+			TCE0.CNT++;
+		}
+	
+		if ((TCE0.INTFLAGS & TC0_OVFIF_bm) && TCE0.INTCTRLA)
+		{
+			TCE0.INTFLAGS &= ~TC0_OVFIF_bm;
+			run_step_isr(TCE0_OVF_vect, MOCK_ISR_TCE0_OVF);
+	
+			/* Writing the CCA flag doesn't clear the pending overflow */
+			TCC0.INTFLAGS |= TC0_OVFIF_bm;
+		}
+	}
+	
+	if ((TCC0.INTFLAGS & TC0_OVFIF_bm) && TCC0.INTCTRLA && TCC0.CTRLA)
+	{
+		TCC0.INTFLAGS &= ~TC0_OVFIF_bm;
+		run_step_isr(TCC0_OVF_vect, MOCK_ISR_TCC0_OVF);
+	}
+	
+	/* The compare matches later in the new period */
+	if (TCC0.INTCTRLB && TCC0.CTRLA)
+	{
+		run_step_isr(TCC0_CCA_vect, MOCK_ISR_TCC0_CCA);
+	}
+	
+	return true;
+}
+
+uint32_t mock_run_move (uint32_t max_periods)
+{
+	uint32_t periods = 0;
+	
+	while (periods < max_periods && mock_run_period())
+	{
+		periods++;
+	}
+	
+	return periods;
+}
+
+/************************************************************************/
+/* IOs                                                                  */
+/************************************************************************/
+void io_pin2in (PORT_t* port, uint8_t pin, uint8_t pull, uint8_t sense)
+{
+	port->DIR &= ~(1 << pin);
+}
+
+void io_pin2out (PORT_t* port, uint8_t pin, uint8_t out, bool input_en)
+{
+	port->DIR |= (1 << pin);
+}
+
+void io_set_int (PORT_t* port, uint8_t int_level, uint8_t int_n, uint8_t mask, bool reset_mask)
+{
+	port->INTCTRL = int_level;
+	port->INT0MASK = mask;
+}
+
+/************************************************************************/
+/* Core                                                                 */
+/************************************************************************/
+void core_func_send_event (uint8_t add, bool use_core_timestamp)
+{
+	mock_events++;
+	mock_last_event = add;
+}
+
+uint32_t core_func_read_R_TIMESTAMP_SECOND (void)
+{
+	return mock_harp_second;
+}
+
+void core_func_mark_user_timestamp (void) {}
+void core_func_update_user_timestamp (uint32_t seconds, uint16_t useconds) {}
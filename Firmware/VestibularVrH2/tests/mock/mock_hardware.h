@@ -0,0 +1,53 @@
+#ifndef _MOCK_HARDWARE_H_
+#define _MOCK_HARDWARE_H_
+#include <avr/io.h>
+#include <stdint.h>
+
+// Define if not defined
+#ifndef bool
+	#define bool uint8_t
+#endif
+#ifndef true
+	#define true 1
+	#define false 0
+#endif
+
+/************************************************************************/
+/* Host simulation of the timers used by the motion modules             */
+/************************************************************************/
+/* Each call to mock_run_period() plays one period of TCC0: the pulse  */
+/* of the period, when CCA isn't zero, and then the overflow, with the  */
+/* event to TCE0, the buffers and the interrupts of the step timer.     */
+/* The other timers, TCC1 with the Harp time and TCE0 when clocked, run */
+/* with mock_advance(). The main loop of main.c, which builds the ramp  */
+/* tables, runs with mock_main_loop() and before each period.           */
+extern int32_t mock_pulses;				// Pulses sent, signed with the direction pin
+extern uint64_t mock_cycles;				// CPU cycles elapsed
+extern uint32_t mock_step_interrupts;	// Calls to the TCC0 and TCE0 interrupts
+extern uint32_t mock_harp_second;
+
+extern uint16_t mock_events;				// Events sent by the firmware
+extern uint8_t mock_last_event;
+
+/* Basic blocks of the firmware run by each step interrupt, counted by  */
+/* the coverage hook when it's built with -fsanitize-coverage=trace-pc, */
+/* see test_isr_cost.c                                                  */
+#define MOCK_ISR_TCC0_OVF 0
+#define MOCK_ISR_TCC0_CCA 1
+#define MOCK_ISR_TCE0_OVF 2
+#define MOCK_STEP_ISRS 3
+
+extern uint32_t mock_isr_blocks;			// Incremented by the coverage hook
+extern uint32_t mock_isr_calls[MOCK_STEP_ISRS];
+extern uint32_t mock_isr_max_blocks[MOCK_STEP_ISRS];
+extern uint64_t mock_isr_total_blocks[MOCK_STEP_ISRS];
+
+void mock_reset (void);
+void mock_sync_ports (void);
+void mock_advance (uint32_t cycles);
+void mock_main_loop (void);
+bool mock_run_period (void);
+uint32_t mock_run_move (uint32_t max_periods);
+uint32_t mock_period_cycles (void);
+
+#endif /* _MOCK_HARDWARE_H_ */
@@ -0,0 +1,646 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "sim_irq.h"
+#include "sim_cycle_timers.h"
+#include "sim_interrupts.h"
+#include "avr_ioport.h"
+#include "avr_uart.h"
+
+/************************************************************************/
+/* Firmware in the loop                                                 */
+/************************************************************************/
+/* Runs the VestibularH2 ELF on the ATxmega32A4U core of simavr with    */
+/* - a virtual stepper driver on MOTOR_PULSE (PC0) and MOTOR_DIRECTION  */
+/*   (PC6), counting the pulses and timing them,                        */
+/* - a virtual quadrature encoder on PC4 and PC5, read by TCD1,         */
+/* - a virtual Harp host on USARTE0, writing the registers and parsing  */
+/*   the messages of the device.                                        */
+/* It measures the latency from a Pulses write to the first pulse, the  */
+/* fastest nominal pulse interval the step interrupt sustains, the      */
+/* events per second received by the host and the share of the CPU     */
+/* taken by the step interrupts at the fastest rates of the ramped      */
+/* moves and of both velocity generators. The run fails when one of    */
+/* them is worse than its limit in benchmark_limits.txt.                */
+/*                                                                      */
+/*   firmware_bench <VestibularH2.elf> <limits> <results> [--record]    */
+/*                                                                      */
+/* --record writes the measured values to the limits file instead.      */
+#define F_CPU 32000000UL
+#define CYCLES_PER_US (F_CPU / 1000000UL)
+
+#define HARP_UART 'E'							// USARTE0
+
+/* Registers, as in hwbp_core_regs.h and app_ios_and_regs.h */
+#define ADD_R_OPERATION_CTRL 0x0A
+#define ADD_REG_CONTROL 32
+#define ADD_REG_PULSES 33
+#define ADD_REG_NOMINAL_PULSE_INTERVAL 34
+#define ADD_REG_INITIAL_PULSE_INTERVAL 35
+#define ADD_REG_PULSE_STEP_INTERVAL 36
+#define ADD_REG_ACCELERATION 44
+#define ADD_REG_VELOCITY 50
+#define ADD_REG_STEP_GENERATOR 63
+
+#define GM_OP_MODE_ACTIVE 0x01
+#define B_ENABLE_MOTOR (1<<0)
+#define B_ENABLE_QUAD_ENCODER (1<<4)
+#define GM_GENERATOR_PERIOD 0
+#define GM_GENERATOR_DDS 1
+
+/* Harp message types and payload types */
+#define HARP_WRITE 2
+#define HARP_EVENT 3
+#define HARP_U8 0x01
+#define HARP_U16 0x02
+#define HARP_U32 0x04
+#define HARP_S16 0x82
+#define HARP_S32 0x84
+
+static avr_t *avr;
+
+static bool run_us (uint32_t time_us)
+{
+	avr_cycle_count_t end = avr->cycle + (avr_cycle_count_t)time_us * CYCLES_PER_US;
+	int state;
+	
+	while (avr->cycle < end)
+	{
+		state = avr_run(avr);
+	
+		if (state == cpu_Done || state == cpu_Crashed)
+		{
+			printf("The firmware stopped at cycle %llu\n", (unsigned long long)avr->cycle);
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+/************************************************************************/
+/* Virtual stepper driver                                               */
+/************************************************************************/
+/* A step on each rising edge of MOTOR_PULSE, the TCC0 output is high   */
+/* from the start of the period until the compare. The direction pin is */
+/* cleared when moving positive.                                        */
+#define MAX_PULSES 20000
+
+static avr_cycle_count_t pulse_cycles[MAX_PULSES];
+static uint32_t pulses;
+static int32_t driver_position;
+static uint32_t pulse_level;
+static uint32_t direction_level;
+
+static void pulse_changed (struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	if (value && !pulse_level)
+	{
+		if (pulses < MAX_PULSES)
+			pulse_cycles[pulses] = avr->cycle;
+	
+		pulses++;
+		driver_position += (direction_level) ? -1 : 1;
+	}
+	
+	pulse_level = value;
+}
+
+static void direction_changed (struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	direction_level = value;
+}
+
+static void clear_pulses (void)
+{
+	pulses = 0;
+	driver_position = 0;
+}
+
+/************************************************************************/
+/* Virtual quadrature encoder                                           */
+/************************************************************************/
+/* Walks the Gray code of the A (PC4) and B (PC5) channels, one count   */
+/* at each step of the code.                                            */
+static const uint8_t quadrature[4] = {0, 1, 3, 2};
+
+static avr_irq_t *encoder_a;
+static avr_irq_t *encoder_b;
+static uint32_t encoder_rate;
+static uint8_t encoder_phase;
+
+static avr_cycle_count_t encoder_tick (avr_t *avr, avr_cycle_count_t when, void *param)
+{
+	encoder_phase = (encoder_phase + 1) & 3;
+	
+	avr_raise_irq(encoder_a, quadrature[encoder_phase] & 1);
+	avr_raise_irq(encoder_b, quadrature[encoder_phase] >> 1);
+	
+	return when + F_CPU / encoder_rate;
+}
+
+static void set_encoder_rate (uint32_t counts_per_second)
+{
+	avr_cycle_timer_cancel(avr, encoder_tick, NULL);
+	encoder_rate = counts_per_second;
+	
+	if (encoder_rate)
+		avr_cycle_timer_register(avr, F_CPU / encoder_rate, encoder_tick, NULL);
+}
+
+/************************************************************************/
+/* Step interrupts                                                      */
+/************************************************************************/
+/* simavr raises the running irq of a vector when its ISR starts and    */
+/* lowers it at the reti. The cycles in between are added up for the    */
+/* overflow and compare of TCC0, with those of the high level           */
+/* interrupts that preempt them, so the load is never underestimated.   */
+#define TCC0_OVF_VECTOR 14
+#define TCC0_CCA_VECTOR 16
+
+static avr_cycle_count_t step_isr_start;
+static avr_cycle_count_t step_isr_cycles;
+
+static void step_isr_running (struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	if (value)
+		step_isr_start = avr->cycle;
+	else
+		step_isr_cycles += avr->cycle - step_isr_start;
+}
+
+static void watch_step_isrs (void)
+{
+	avr_irq_register_notify(avr_get_interrupt_irq(avr, TCC0_OVF_VECTOR) + AVR_INT_IRQ_RUNNING, step_isr_running, NULL);
+	avr_irq_register_notify(avr_get_interrupt_irq(avr, TCC0_CCA_VECTOR) + AVR_INT_IRQ_RUNNING, step_isr_running, NULL);
+}
+
+/************************************************************************/
+/* Virtual Harp host                                                    */
+/************************************************************************/
+/* The messages are [type, length, address, port, payload type,        */
+/* payload, checksum], the length counting the bytes after it and the   */
+/* checksum the sum of the bytes before it. The bytes are handed to the */
+/* UART while it signals room in its input queue.                       */
+static avr_irq_t *uart_input;
+static uint8_t tx_queue[256];
+static uint8_t tx_head;
+static uint8_t tx_tail;
+static bool uart_xon = true;
+
+static uint8_t rx_message[64];
+static uint8_t rx_length;
+static uint32_t events;
+static uint32_t checksum_errors;
+
+static avr_cycle_count_t command_cycle;
+
+static void send_queued_bytes (void)
+{
+	while (uart_xon && tx_tail != tx_head)
+	{
+		avr_raise_irq(uart_input, tx_queue[tx_tail++]);
+	}
+}
+
+static void uart_xon_changed (struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	uart_xon = true;
+	send_queued_bytes();
+}
+
+static void uart_xoff_changed (struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	uart_xon = false;
+}
+
+static void uart_output (struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	uint8_t checksum;
+	uint8_t size;
+	
+	rx_message[rx_length++] = value;
+	
+	while (rx_length >= 2)
+	{
+		size = rx_message[1] + 2;
+	
+		/* Not a message, the next byte may start one */
+		if (size < 6 || size > sizeof(rx_message))
+		{
+			memmove(rx_message, rx_message + 1, --rx_length);
+			continue;
+		}
+	
+		if (rx_length < size)
+			return;
+	
+		checksum = 0;
+	
+		for (uint8_t i = 0; i < size - 1; i++)
+		{
+			checksum += rx_message[i];
+		}
+	
+		if (checksum == rx_message[size - 1])
+		{
+			if (rx_message[0] == HARP_EVENT)
+				events++;
+	
+			rx_length -= size;
+			memmove(rx_message, rx_message + size, rx_length);
+		}
+		else
+		{
+			checksum_errors++;
+			memmove(rx_message, rx_message + 1, --rx_length);
+		}
+	}
+}
+
+static void harp_write (uint8_t address, uint8_t payload_type, uint32_t value)
+{
+	uint8_t size = payload_type & 0x0F;
+	uint8_t message[5 + 4 + 1] = {HARP_WRITE, size + 4, address, 255, payload_type};
+	uint8_t checksum = 0;
+	
+	for (uint8_t i = 0; i < size; i++)
+	{
+		message[5 + i] = value >> (8 * i);
+	}
+	
+	for (uint8_t i = 0; i < 5 + size; i++)
+	{
+		checksum += message[i];
+	}
+	
+	message[5 + size] = checksum;
+	
+	for (uint8_t i = 0; i < 5 + size + 1; i++)
+	{
+		tx_queue[tx_head++] = message[i];
+	}
+	
+	/* The command starts with its first byte on the line */
+	command_cycle = avr->cycle;
+	send_queued_bytes();
+}
+
+/************************************************************************/
+/* Measurements                                                         */
+/************************************************************************/
+static bool wait_move (uint32_t steps, uint32_t timeout_ms)
+{
+	for (uint32_t ms = 0; ms < timeout_ms && pulses < steps; ms++)
+	{
+		if (run_us(1000) == false)
+			return false;
+	}
+	
+	/* Nothing after the last step */
+	if (run_us(10000) == false)
+		return false;
+	
+	return pulses == steps && driver_position == (int32_t)steps;
+}
+
+static bool measure_command_latency (double *latency_us)
+{
+	clear_pulses();
+	harp_write(ADD_REG_PULSES, HARP_S32, 1000);
+	
+	if (wait_move(1000, 2000) == false)
+	{
+		printf("The move of the latency test sent %u pulses instead of 1000\n", pulses);
+		return false;
+	}
+	
+	*latency_us = (double)(pulse_cycles[0] - command_cycle) / CYCLES_PER_US;
+	return true;
+}
+
+static bool cruise_sustained (uint32_t interval_us, uint32_t steps)
+{
+	uint32_t ramp_steps = (2000 - interval_us) / 10;
+	uint32_t cruise_steps = 0;
+	uint32_t period;
+	
+	for (uint32_t i = 1; i < steps && i < MAX_PULSES; i++)
+	{
+		period = pulse_cycles[i] - pulse_cycles[i - 1];
+	
+		/* Faster than the nominal interval, a period was cut short */
+		if (period * 100 < interval_us * CYCLES_PER_US * 99)
+			return false;
+	
+		if (period * 100 <= interval_us * CYCLES_PER_US * 101)
+			cruise_steps++;
+	}
+	
+	/* All the pulses between the two ramps at the nominal interval */
+	return cruise_steps + 2 >= steps - 2 * ramp_steps;
+}
+
+static bool measure_max_step_rate (double *steps_per_second)
+{
+	static const uint32_t intervals_us[] = {100, 80, 60, 50, 40, 30, 25, 20};
+	
+	*steps_per_second = 0;
+	
+	harp_write(ADD_REG_INITIAL_PULSE_INTERVAL, HARP_U32, 2000);
+	harp_write(ADD_REG_PULSE_STEP_INTERVAL, HARP_U16, 10);
+	
+	/* The encoder and its events load the CPU as in an experiment */
+	set_encoder_rate(20000);
+	
+	for (uint8_t i = 0; i < sizeof(intervals_us) / sizeof(intervals_us[0]); i++)
+	{
+		harp_write(ADD_REG_NOMINAL_PULSE_INTERVAL, HARP_U32, intervals_us[i]);
+	
+		if (run_us(2000) == false)
+			return false;
+	
+		clear_pulses();
+		harp_write(ADD_REG_PULSES, HARP_S32, 4000);
+	
+		if (wait_move(4000, 5000) == false || cruise_sustained(intervals_us[i], 4000) == false)
+			break;
+	
+		*steps_per_second = 1e6 / intervals_us[i];
+	
+		/* Back to the start */
+		clear_pulses();
+		harp_write(ADD_REG_PULSES, HARP_S32, -4000);
+	
+		if (run_us(1000000) == false)
+			return false;
+	}
+	
+	set_encoder_rate(0);
+	
+	/* The parameters only change once stopped */
+	if (run_us(1000000) == false)
+		return false;
+	
+	harp_write(ADD_REG_NOMINAL_PULSE_INTERVAL, HARP_U32, 250);
+	
+	return run_us(10000);
+}
+
+static bool measure_event_rate (double *events_per_second)
+{
+	/* Encoder and position events while moving, for one second */
+	set_encoder_rate(20000);
+	clear_pulses();
+	harp_write(ADD_REG_PULSES, HARP_S32, 8000);
+	
+	if (run_us(100000) == false)
+		return false;
+	
+	events = 0;
+	
+	if (run_us(1000000) == false)
+		return false;
+	
+	*events_per_second = events;
+	
+	set_encoder_rate(0);
+	return wait_move(8000, 3000);
+}
+
+/* Share of one second taken by the step interrupts, in percent */
+static bool measure_step_load (double *load)
+{
+	avr_cycle_count_t start;
+	
+	step_isr_cycles = 0;
+	start = avr->cycle;
+	
+	if (run_us(1000000) == false)
+		return false;
+	
+	*load = 100.0 * step_isr_cycles / (avr->cycle - start);
+	return true;
+}
+
+/* The cruise of a ramped move at the shortest nominal interval */
+static bool measure_ramped_load (double *load)
+{
+	harp_write(ADD_REG_NOMINAL_PULSE_INTERVAL, HARP_U32, 20);
+	
+	if (run_us(10000) == false)
+		return false;
+	
+	clear_pulses();
+	harp_write(ADD_REG_PULSES, HARP_S32, 80000);
+	
+	if (run_us(200000) == false || measure_step_load(load) == false)
+		return false;
+	
+	if (wait_move(80000, 2000) == false)
+	{
+		printf("The move of the load test sent %u pulses instead of 80000\n", pulses);
+		return false;
+	}
+	
+	return true;
+}
+
+/* The velocity mode at its fastest speed with the nominal interval of  */
+/* the ramped test, 32767 steps/s for the period generator and half the */
+/* DDS tick rate of the default build for the DDS generator             */
+static bool measure_velocity_load (uint8_t generator, int16_t velocity, double *load)
+{
+	harp_write(ADD_REG_STEP_GENERATOR, HARP_U8, generator);
+	harp_write(ADD_REG_ACCELERATION, HARP_U32, 1000000);
+	harp_write(ADD_REG_VELOCITY, HARP_S16, (uint16_t)velocity);
+	
+	if (run_us(100000) == false || measure_step_load(load) == false)
+		return false;
+	
+	harp_write(ADD_REG_VELOCITY, HARP_S16, 0);
+	
+	return run_us(100000);
+}
+
+/************************************************************************/
+/* Limits                                                               */
+/************************************************************************/
+/* The latency and the loads are maximums, the step and event rates are */
+/* minimums.                                                            */
+typedef struct
+{
+	const char *name;
+	bool maximum;
+	double value;
+	double limit;
+} metric_t;
+
+static metric_t metrics[] =
+{
+	{"command_latency_us", true},
+	{"max_step_rate", false},
+	{"event_rate", false},
+	{"step_load_ramped", true},
+	{"step_load_period", true},
+	{"step_load_dds", true},
+};
+
+#define N_METRICS (sizeof(metrics) / sizeof(metrics[0]))
+
+static bool read_limits (const char *path)
+{
+	FILE *file = fopen(path, "r");
+	char line[128];
+	char name[64];
+	double limit;
+	uint8_t found = 0;
+	
+	if (file == NULL)
+		return false;
+	
+	while (fgets(line, sizeof(line), file))
+	{
+		if (line[0] == '#' || sscanf(line, "%63s %lf", name, &limit) != 2)
+			continue;
+	
+		for (uint8_t i = 0; i < N_METRICS; i++)
+		{
+			if (strcmp(name, metrics[i].name) == 0)
+			{
+				metrics[i].limit = limit;
+				found++;
+			}
+		}
+	}
+	
+	fclose(file);
+	return found == N_METRICS;
+}
+
+static bool write_metrics (const char *path, bool values)
+{
+	FILE *file = fopen(path, "w");
+	
+	if (file == NULL)
+		return false;
+	
+	fprintf(file, "# Limits of the firmware benchmark, see firmware_bench.c. The latency\n");
+	fprintf(file, "# and the step loads, in percent, are maximums, the step and event\n");
+	fprintf(file, "# rates are minimums.\n");
+	
+	for (uint8_t i = 0; i < N_METRICS; i++)
+	{
+		fprintf(file, "%-20s %.1f\n", metrics[i].name, (values) ? metrics[i].value : metrics[i].limit);
+	}
+	
+	fclose(file);
+	return true;
+}
+
+int main (int argc, char **argv)
+{
+	elf_firmware_t firmware = {{0}};
+	uint32_t flags = 0;
+	bool record = (argc > 4 && strcmp(argv[4], "--record") == 0);
+	int failures = 0;
+	
+	if (argc < 4)
+	{
+		printf("usage: firmware_bench <VestibularH2.elf> <limits> <results> [--record]\n");
+		return 1;
+	}
+	
+	if (!record && read_limits(argv[2]) == false)
+	{
+		printf("Can't read the limits of %s\n", argv[2]);
+		return 1;
+	}
+	
+	if (elf_read_firmware(argv[1], &firmware) != 0)
+	{
+		printf("Can't read %s\n", argv[1]);
+		return 1;
+	}
+	
+	/* The ELF of the Atmel Studio project has no .mmcu section */
+	snprintf(firmware.mmcu, sizeof(firmware.mmcu), "atxmega32a4u");
+	firmware.frequency = F_CPU;
+	
+	avr = avr_make_mcu_by_name(firmware.mmcu);
+	
+	if (avr == NULL)
+	{
+		printf("This simavr has no %s core\n", firmware.mmcu);
+		return 1;
+	}
+	
+	avr_init(avr);
+	avr_load_firmware(avr, &firmware);
+	
+	/* Peripherals */
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('C'), 0), pulse_changed, NULL);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('C'), 6), direction_changed, NULL);
+	watch_step_isrs();
+	
+	encoder_a = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('C'), 4);
+	encoder_b = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('C'), 5);
+	
+	avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS(HARP_UART), &flags);
+	flags &= ~AVR_UART_FLAG_STDIO;
+	avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS(HARP_UART), &flags);
+	
+	uart_input = avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ(HARP_UART), UART_IRQ_INPUT);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ(HARP_UART), UART_IRQ_OUTPUT), uart_output, NULL);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ(HARP_UART), UART_IRQ_OUT_XON), uart_xon_changed, NULL);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ(HARP_UART), UART_IRQ_OUT_XOFF), uart_xoff_changed, NULL);
+	
+	/* Boot, then the active mode for the events and the motor enabled */
+	if (run_us(200000) == false)
+		return 1;
+	
+	harp_write(ADD_R_OPERATION_CTRL, HARP_U8, GM_OP_MODE_ACTIVE);
+	harp_write(ADD_REG_CONTROL, HARP_U8, B_ENABLE_MOTOR | B_ENABLE_QUAD_ENCODER);
+	
+	if (run_us(10000) == false)
+		return 1;
+	
+	if (measure_command_latency(&metrics[0].value) == false ||
+		measure_max_step_rate(&metrics[1].value) == false ||
+		measure_event_rate(&metrics[2].value) == false ||
+		measure_ramped_load(&metrics[3].value) == false ||
+		measure_velocity_load(GM_GENERATOR_PERIOD, 32767, &metrics[4].value) == false ||
+		measure_velocity_load(GM_GENERATOR_DDS, 12500, &metrics[5].value) == false)
+	{
+		return 1;
+	}
+	
+	if (checksum_errors)
+	{
+		printf("%u messages of the device with a wrong checksum\n", checksum_errors);
+		failures++;
+	}
+	
+	if (record)
+		return write_metrics(argv[2], true) ? failures : 1;
+	
+	for (uint8_t i = 0; i < N_METRICS; i++)
+	{
+		bool worse = (metrics[i].maximum) ? metrics[i].value > metrics[i].limit : metrics[i].value < metrics[i].limit;
+	
+		printf("%-20s %10.1f  limit %10.1f  %s\n", metrics[i].name, metrics[i].value, metrics[i].limit, (worse) ? "WORSE" : "ok");
+	
+		if (worse)
+			failures++;
+	}
+	
+	/* The build only gets the results when nothing is worse */
+	if (failures == 0 && write_metrics(argv[3], true) == false)
+		return 1;
+	
+	return failures;
+}
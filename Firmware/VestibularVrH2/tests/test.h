@@ -0,0 +1,29 @@
+#ifndef _TEST_H_
+#define _TEST_H_
+#include <stdio.h>
+#include <stdint.h>
+#include "mock_hardware.h"
+
+/************************************************************************/
+/* Host tests of the motion modules                                     */
+/************************************************************************/
+/* Each test program returns the number of failed checks, so ctest     */
+/* reports it as failed with the checks printed.                        */
+extern int test_failures;
+
+#define CHECK(condition) \
+	do { if (!(condition)) { printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); test_failures++; } } while (0)
+
+#define CHECK_EQUAL(expected, actual) \
+	do { long long e = (expected), a = (actual); if (e != a) { printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, a, e); test_failures++; } } while (0)
+
+#define RUN_TEST(test) \
+	do { int failures = test_failures; test(); printf("%s %s\n", (test_failures == failures) ? "PASS" : "FAIL", #test); } while (0)
+
+/* Registers as after a reset of the device, with the motor enabled */
+void test_reset_device (void);
+
+/* Period of TCC0 in microseconds */
+double test_period_us (void);
+
+#endif /* _TEST_H_ */
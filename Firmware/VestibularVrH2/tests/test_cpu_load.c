@@ -0,0 +1,194 @@
+#include "test.h"
+#include "app_ios_and_regs.h"
+#include "stepper_motor.h"
+
+/************************************************************************/
+/* CPU load of the step generators                                      */
+/************************************************************************/
+/* The period generator takes an overflow and a compare interrupt for   */
+/* each pulse, so its load follows the speed. The DDS generator takes   */
+/* one interrupt every tick whatever the speed. Built once for each     */
+/* DDS_TICK_RATE, see CMakeLists.txt, this runs one simulated second at */
+/* a few cruise speeds and at the fastest speed of each generator and   */
+/* of the ramped moves, and weighs each interrupt by its cost. The      */
+/* cruise of a ramped move only takes the overflow of each pulse.       */
+/*                                                                      */
+/* The firmware is built with -fsanitize-coverage=trace-pc and the mock */
+/* counts the basic blocks run by each interrupt, as in                 */
+/* test_isr_cost.c. The cycles are estimated from them: ISR_CYCLES for  */
+/* the response, the jump of the vector, the registers saved and        */
+/* restored and the reti, and BLOCK_CYCLES for each block. Counted by   */
+/* hand on the listing of the ramped overflow, about 60 and 10 cycles,  */
+/* rounded up. The step interrupts of the real firmware are timed by    */
+/* firmware_bench under simavr against the same bound.                  */
+#define SECOND_CYCLES 32000000UL
+
+#define ISR_CYCLES 65
+#define BLOCK_CYCLES 12
+
+/* The rest is left to the Harp core, the encoder and the external control */
+#define MAX_STEP_LOAD 0.5
+
+static const int16_t speeds[] = {100, 1000, 4000};
+
+/* Fastest velocity register, and fastest DDS speed with a tick without pulse between pulses */
+#define MAX_VELOCITY 32767
+#define MAX_DDS_VELOCITY ((DDS_TICK_RATE / 2 < MAX_VELOCITY) ? DDS_TICK_RATE / 2 : MAX_VELOCITY)
+
+/* Fastest nominal pulse interval of the ramped moves */
+#define MIN_NOMINAL_US 20
+
+void __sanitizer_cov_trace_pc (void)
+{
+	mock_isr_blocks++;
+}
+
+static double step_isr_cycles (void)
+{
+	double cycles = 0;
+	
+	for (uint8_t i = 0; i < MOCK_STEP_ISRS; i++)
+	{
+		cycles += (double)mock_isr_calls[i] * ISR_CYCLES + (double)mock_isr_total_blocks[i] * BLOCK_CYCLES;
+	}
+	
+	return cycles;
+}
+
+static void clear_isr_costs (void)
+{
+	mock_step_interrupts = 0;
+	
+	for (uint8_t i = 0; i < MOCK_STEP_ISRS; i++)
+	{
+		mock_isr_calls[i] = 0;
+		mock_isr_total_blocks[i] = 0;
+	}
+}
+
+static void run_velocity (uint64_t cycles)
+{
+	uint64_t end = mock_cycles + cycles;
+	uint64_t next_update = mock_cycles + 32000;
+	
+	while (mock_cycles < end && mock_run_period())
+	{
+		/* The 1 ms callback of app.c */
+		if (mock_cycles >= next_update)
+		{
+			next_update += 32000;
+			update_velocity_mode();
+		}
+	}
+}
+
+static void measure_second (uint8_t generator, int16_t speed, uint32_t *interrupts, int32_t *pulses, double *load)
+{
+	uint64_t start;
+	
+	test_reset_device();
+	update_step_generator(generator);
+	update_nominal_pulse_interval(MIN_NOMINAL_US);
+	update_acceleration(1000000);
+	mock_main_loop();
+	
+	/* Up to the cruise speed before counting */
+	set_target_velocity(speed);
+	run_velocity(SECOND_CYCLES / 2);
+	
+	clear_isr_costs();
+	*pulses = mock_pulses;
+	start = mock_cycles;
+	
+	run_velocity(SECOND_CYCLES);
+	
+	*interrupts = mock_step_interrupts;
+	*pulses = mock_pulses - *pulses;
+	*load = step_isr_cycles() / (mock_cycles - start);
+	
+	set_target_velocity(0);
+	stop_rotation();
+}
+
+static void test_cpu_load (void)
+{
+	uint32_t period_interrupts;
+	uint32_t dds_interrupts;
+	double period_load;
+	double dds_load;
+	int32_t pulses;
+	
+	printf("DDS at %u Hz, step interrupts per second and estimated CPU load\n", DDS_TICK_RATE);
+	printf("%8s %10s %7s %10s %7s\n", "steps/s", "period", "load", "DDS", "load");
+	
+	for (uint8_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++)
+	{
+		measure_second(GM_GENERATOR_PERIOD, speeds[i], &period_interrupts, &pulses, &period_load);
+	
+		/* An overflow and a compare for each pulse */
+		CHECK(pulses > speeds[i] * 0.99 && pulses < speeds[i] * 1.01);
+		CHECK(period_interrupts >= 2 * pulses - 2 && period_interrupts <= 2 * pulses + 2);
+	
+		measure_second(GM_GENERATOR_DDS, speeds[i], &dds_interrupts, &pulses, &dds_load);
+	
+		/* One overflow for each tick, whatever the speed */
+		CHECK(pulses > speeds[i] * 0.99 && pulses < speeds[i] * 1.01);
+		CHECK(dds_interrupts >= DDS_TICK_RATE - 1 && dds_interrupts <= DDS_TICK_RATE + 1);
+	
+		printf("%8d %10u %6.1f%% %10u %6.1f%%\n", speeds[i], period_interrupts, period_load * 100, dds_interrupts, dds_load * 100);
+	}
+	
+	/* Above this speed the DDS generator takes fewer interrupts */
+	printf("DDS is lighter above %u steps/s\n", DDS_TICK_RATE / 2);
+}
+
+/* Each generator at its fastest speed, and the cruise of a ramped move */
+/* at the shortest nominal interval                                     */
+static void test_max_step_rate_load (void)
+{
+	uint32_t interrupts;
+	int32_t pulses;
+	double load;
+	uint64_t start;
+	
+	measure_second(GM_GENERATOR_PERIOD, MAX_VELOCITY, &interrupts, &pulses, &load);
+	printf("period generator at %d steps/s: %.1f%%\n", pulses, load * 100);
+	CHECK(pulses > MAX_VELOCITY * 0.9);
+	CHECK(load <= MAX_STEP_LOAD);
+	
+	measure_second(GM_GENERATOR_DDS, MAX_DDS_VELOCITY, &interrupts, &pulses, &load);
+	printf("DDS generator at %d steps/s: %.1f%%\n", pulses, load * 100);
+	CHECK(pulses > MAX_DDS_VELOCITY * 0.99);
+	CHECK(load <= MAX_STEP_LOAD);
+	
+	/* A second of cruise between the ramps */
+	test_reset_device();
+	update_nominal_pulse_interval(MIN_NOMINAL_US);
+	mock_main_loop();
+	start_rotation(3000000 / MIN_NOMINAL_US);
+	
+	while (mock_cycles < SECOND_CYCLES / 2 && mock_run_period());
+	
+	clear_isr_costs();
+	pulses = mock_pulses;
+	start = mock_cycles;
+	
+	while (mock_cycles < start + SECOND_CYCLES && mock_run_period());
+	
+	pulses = mock_pulses - pulses;
+	load = step_isr_cycles() / (mock_cycles - start);
+	
+	printf("ramped move at %d steps/s: %.1f%%\n", pulses, load * 100);
+	CHECK(pulses == 1000000 / MIN_NOMINAL_US);
+	CHECK(load <= MAX_STEP_LOAD);
+	
+	stop_rotation();
+}
+
+int main (void)
+{
+	RUN_TEST(test_cpu_load);
+	RUN_TEST(test_max_step_rate_load);
+	
+	return test_failures != 0;
+}
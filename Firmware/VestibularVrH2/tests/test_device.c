@@ -0,0 +1,53 @@
+#include "test.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+#include "stepper_motor.h"
+
+extern AppRegs app_regs;
+
+int test_failures = 0;
+
+void test_reset_device (void)
+{
+	uint8_t control = B_ENABLE_MOTOR;
+	
+	stop_rotation();
+	mock_reset();
+	
+	/* Same defaults as core_callback_reset_registers() */
+	app_regs.REG_NOMINAL_PULSE_INTERVAL = 250;
+	app_regs.REG_INITIAL_PULSE_INTERVAL = 2000;
+	app_regs.REG_PULSE_STEP_INTERVAL = 10;
+	app_regs.REG_PULSE_PERIOD = 50;
+	app_regs.REG_PROFILE_TYPE = GM_PROFILE_LINEAR;
+	app_regs.REG_ACCELERATION = 40000;
+	app_regs.REG_JERK = 2000000;
+	app_regs.REG_CLOSED_LOOP = 0;
+	app_regs.REG_STEP_GENERATOR = GM_GENERATOR_PERIOD;
+	app_regs.REG_HARDWARE_CRUISE = 0;
+	app_regs.REG_TRACE_CONTROL = 0;
+	
+	app_write_REG_CONTROL(&control);
+	app_write_REG_NOMINAL_PULSE_INTERVAL(&app_regs.REG_NOMINAL_PULSE_INTERVAL);
+	app_write_REG_INITIAL_PULSE_INTERVAL(&app_regs.REG_INITIAL_PULSE_INTERVAL);
+	app_write_REG_PULSE_STEP_INTERVAL(&app_regs.REG_PULSE_STEP_INTERVAL);
+	app_write_REG_PULSE_PERIOD(&app_regs.REG_PULSE_PERIOD);
+	app_write_REG_PROFILE_TYPE(&app_regs.REG_PROFILE_TYPE);
+	app_write_REG_ACCELERATION(&app_regs.REG_ACCELERATION);
+	app_write_REG_JERK(&app_regs.REG_JERK);
+	app_write_REG_CLOSED_LOOP(&app_regs.REG_CLOSED_LOOP);
+	app_write_REG_STEP_GENERATOR(&app_regs.REG_STEP_GENERATOR);
+	app_write_REG_HARDWARE_CRUISE(&app_regs.REG_HARDWARE_CRUISE);
+	app_write_REG_TRACE_CONTROL(&app_regs.REG_TRACE_CONTROL);
+	
+	/* REG_CONTROL is applied by the 500 us callback of app.c */
+	app_regs.REG_CONTROL = control;
+	
+	set_motor_position(0);
+	mock_main_loop();
+}
+
+double test_period_us (void)
+{
+	return mock_period_cycles() / 32.0;
+}
@@ -0,0 +1,100 @@
+#include "test.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+#include "stepper_motor.h"
+
+/************************************************************************/
+/* Cost of the step interrupts                                          */
+/************************************************************************/
+/* The firmware of this test is built with -fsanitize-coverage=trace-pc */
+/* so the hook below runs at the start of every basic block, and the    */
+/* mock adds up the blocks of each interrupt. The count stands in for   */
+/* the cycles of the AVR: a loop or a planning call shows up as blocks, */
+/* the arithmetic within a block doesn't.                               */
+void __sanitizer_cov_trace_pc (void)
+{
+	mock_isr_blocks++;
+}
+
+/* Blocks of ramp_seek() and of its branch in step_overflow() */
+#define RAMP_SEEK_BLOCKS 4
+
+static void print_costs (const char *move)
+{
+	printf("%-28s overflow max %3u mean %5.1f, compare max %3u mean %5.1f\n", move,
+		mock_isr_max_blocks[MOCK_ISR_TCC0_OVF],
+		(double)mock_isr_total_blocks[MOCK_ISR_TCC0_OVF] / mock_isr_calls[MOCK_ISR_TCC0_OVF],
+		mock_isr_max_blocks[MOCK_ISR_TCC0_CCA],
+		(double)mock_isr_total_blocks[MOCK_ISR_TCC0_CCA] / mock_isr_calls[MOCK_ISR_TCC0_CCA]);
+}
+
+static uint32_t ramped_move_overflow_cost (void)
+{
+	test_reset_device();
+	
+	start_rotation(2000);
+	mock_run_move(100000);
+	
+	CHECK_EQUAL(2000, mock_pulses);
+	print_costs("2000 steps");
+	
+	return mock_isr_max_blocks[MOCK_ISR_TCC0_OVF];
+}
+
+/* A step of the ramp costs the same with one table entry for each step */
+/* and with the entries 32 steps apart                                  */
+static void test_ramp_step_cost (void)
+{
+	uint32_t reference = ramped_move_overflow_cost();
+	
+	test_reset_device();
+	update_motion_parameters(250, 10000, 2, 50, GM_PROFILE_LINEAR, 40000, 2000000);
+	mock_main_loop();
+	
+	start_rotation(12000);
+	mock_run_move(100000);
+	
+	CHECK_EQUAL(12000, mock_pulses);
+	print_costs("12000 steps, sub-sampled");
+	
+	CHECK(mock_isr_max_blocks[MOCK_ISR_TCC0_OVF] <= reference);
+}
+
+/* The segments, the ramp changes and the requests during the move are */
+/* planned by the compare, the overflow only adds the seek of a jump    */
+/* along the ramp when the new request is too late to stop smoothly    */
+static void test_move_change_cost (void)
+{
+	uint32_t reference = ramped_move_overflow_cost();
+	int32_t segments[8] = {400, 500, 300, 0, 600, 300, 0, 0};
+	uint32_t nominal = 200;
+	
+	test_reset_device();
+	
+	CHECK(app_write_REG_SEGMENTS(segments));
+	start_queued_segments();
+	mock_run_move(350);
+	
+	/* A new ramp */
+	CHECK(app_write_REG_NOMINAL_PULSE_INTERVAL(&nominal));
+	mock_run_move(300);
+	
+	/* Longer, then shorter than the ramp down, and back */
+	user_sent_request(1000);
+	mock_run_move(200);
+	user_sent_request(-1500);
+	mock_run_move(100000);
+	
+	CHECK_EQUAL(800, mock_pulses);
+	print_costs("segments and requests");
+	
+	CHECK(mock_isr_max_blocks[MOCK_ISR_TCC0_OVF] <= reference + RAMP_SEEK_BLOCKS);
+}
+
+int main (void)
+{
+	RUN_TEST(test_ramp_step_cost);
+	RUN_TEST(test_move_change_cost);
+	
+	return test_failures != 0;
+}
@@ -0,0 +1,500 @@
+#include <math.h>
+#include "test.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+#include "stepper_motor.h"
+#include "encoder.h"
+
+extern AppRegs app_regs;
+extern bool hardware_cruise;
+
+/************************************************************************/
+/* Moves                                                                */
+/************************************************************************/
+/* The position of the firmware must always match the pulses sent with */
+/* the direction pin, and a change of direction only happens after the  */
+/* motor slowed down to the initial interval.                           */
+static uint32_t direction_changes;
+static double slowest_reversal_us;
+static uint32_t position_mismatches;
+static int32_t previous_direction;
+
+static void reset_checks (void)
+{
+	direction_changes = 0;
+	slowest_reversal_us = 0;
+	position_mismatches = 0;
+	previous_direction = 0;
+}
+
+static void run_checked_period (void)
+{
+	int32_t previous_pulses = mock_pulses;
+	int32_t direction;
+	double period = test_period_us();
+	
+	mock_run_period();
+	
+	if (mock_pulses == previous_pulses)
+		return;
+	
+	direction = mock_pulses - previous_pulses;
+	
+	if (previous_direction && direction != previous_direction)
+	{
+		direction_changes++;
+	
+		if (slowest_reversal_us == 0 || period < slowest_reversal_us)
+			slowest_reversal_us = period;
+	}
+	
+	previous_direction = direction;
+	
+	if (get_motor_position() != mock_pulses)
+		position_mismatches++;
+}
+
+static void run_checked_move (void)
+{
+	uint32_t n = 0;
+	
+	while (mock_period_cycles() && n++ < 1000000)
+	{
+		run_checked_period();
+	}
+}
+
+static void test_reversal (void)
+{
+	for (uint8_t hardware_cruise = 0; hardware_cruise < 2; hardware_cruise++)
+	{
+		test_reset_device();
+		reset_checks();
+		update_hardware_cruise(hardware_cruise);
+	
+		start_rotation(3000);
+	
+		for (uint16_t i = 0; i < 1000; i++)
+		{
+			run_checked_period();
+		}
+	
+		/* Back to the start from the cruise speed */
+		user_sent_request(-3000);
+	
+		run_checked_move();
+	
+		CHECK_EQUAL(0, mock_pulses);
+		CHECK_EQUAL(0, get_motor_position());
+		CHECK_EQUAL(0, position_mismatches);
+		CHECK_EQUAL(1, direction_changes);
+	
+		/* The direction changes at the initial interval */
+		CHECK(slowest_reversal_us >= 2000 - 0.1);
+	}
+}
+
+static void test_extended_move (void)
+{
+	test_reset_device();
+	reset_checks();
+	
+	start_rotation(1000);
+	
+	for (uint16_t i = 0; i < 500; i++)
+	{
+		run_checked_period();
+	}
+	
+	/* Same direction, the move goes on without stopping */
+	user_sent_request(700);
+	
+	run_checked_move();
+	
+	CHECK_EQUAL(1700, mock_pulses);
+	CHECK_EQUAL(1700, get_motor_position());
+	CHECK_EQUAL(0, direction_changes);
+}
+
+/* The parameters and the steps of a motion command during a ramped move */
+/* apply from the next pulse, without stopping                          */
+static void test_motion_command_during_move (void)
+{
+	int32_t command[8] = {1000, 200, 2000, 10, 50, GM_PROFILE_LINEAR, 40000, 2000000};
+	double fastest_us = 1e9;
+	uint32_t n = 0;
+	
+	test_reset_device();
+	reset_checks();
+	
+	start_rotation(2000);
+	
+	for (uint16_t i = 0; i < 500; i++)
+	{
+		run_checked_period();
+	}
+	
+	CHECK(app_write_REG_MOTION_COMMAND(command));
+	
+	/* Faster up to the new nominal interval, never back to the start */
+	while (mock_period_cycles() && n++ < 1000000)
+	{
+		if (test_period_us() < fastest_us)
+			fastest_us = test_period_us();
+	
+		CHECK(test_period_us() <= 250 + 0.1 || mock_pulses > 2700);
+		run_checked_period();
+	}
+	
+	CHECK_EQUAL(3000, mock_pulses);
+	CHECK_EQUAL(3000, get_motor_position());
+	CHECK_EQUAL(0, position_mismatches);
+	CHECK_EQUAL(0, direction_changes);
+	CHECK(fastest_us >= 200 - 0.1 && fastest_us <= 200 + 0.1);
+}
+
+static void test_back_to_back_requests (void)
+{
+	test_reset_device();
+	reset_checks();
+	update_hardware_cruise(true);
+	
+	start_rotation(3000);
+	
+	for (uint16_t i = 0; i < 1000; i++)
+	{
+		run_checked_period();
+	}
+	
+	CHECK(hardware_cruise);
+	
+	/* Posted one after the other before the step ISR takes any of them */
+	user_sent_request(500);
+	user_sent_request(-200);
+	user_sent_request(100);
+	CHECK_EQUAL(3400, get_final_motor_position());
+	
+	/* The cruise is cut at the next pulse, which takes them all */
+	run_checked_period();
+	
+	CHECK(!hardware_cruise);
+	CHECK_EQUAL(mock_pulses, get_motor_position());
+	CHECK_EQUAL(3400, get_final_motor_position());
+	
+	run_checked_move();
+	
+	CHECK_EQUAL(3400, mock_pulses);
+	CHECK_EQUAL(3400, get_motor_position());
+	CHECK_EQUAL(0, position_mismatches);
+	CHECK_EQUAL(0, direction_changes);
+}
+
+static void test_scheduled_requests (void)
+{
+	test_reset_device();
+	reset_checks();
+	
+	CHECK(schedule_start(1001, 0));
+	
+	/* The requests wait in the mailbox for the scheduled start */
+	user_sent_request(500);
+	user_sent_request(200);
+	CHECK_EQUAL(700, get_final_motor_position());
+	CHECK_EQUAL(0, mock_period_cycles());
+	
+	while (mock_harp_second < 1001 || get_scheduled_start())
+	{
+		mock_advance(32000);
+	}
+	
+	run_checked_move();
+	
+	CHECK_EQUAL(700, mock_pulses);
+	CHECK_EQUAL(700, get_motor_position());
+	
+	/* Discarded with the schedule */
+	CHECK(schedule_start(1003, 0));
+	user_sent_request(300);
+	cancel_scheduled_start();
+	
+	CHECK_EQUAL(700, get_final_motor_position());
+}
+
+static void test_move_to (void)
+{
+	int32_t target = 1500;
+	
+	test_reset_device();
+	reset_checks();
+	
+	CHECK(app_write_REG_MOVE_TO(&target));
+	CHECK_EQUAL(1500, get_final_motor_position());
+	
+	run_checked_move();
+	
+	CHECK_EQUAL(1500, get_motor_position());
+	CHECK_EQUAL(1500, mock_pulses);
+	
+	/* A new target during the move, behind the current position */
+	target = 4000;
+	CHECK(app_write_REG_MOVE_TO(&target));
+	
+	for (uint16_t i = 0; i < 800; i++)
+	{
+		run_checked_period();
+	}
+	
+	target = -500;
+	CHECK(app_write_REG_MOVE_TO(&target));
+	
+	run_checked_move();
+	
+	CHECK_EQUAL(-500, get_motor_position());
+	CHECK_EQUAL(-500, mock_pulses);
+	CHECK_EQUAL(0, position_mismatches);
+	CHECK_EQUAL(1, direction_changes);
+	
+	/* Moving to the current position doesn't move */
+	CHECK(app_write_REG_MOVE_TO(&target));
+	CHECK_EQUAL(0, mock_period_cycles());
+}
+
+static void test_segments (void)
+{
+	int32_t segments[8] = {400, 500, 300, 0, -200, 1000, 0, 0};
+	
+	test_reset_device();
+	reset_checks();
+	
+	CHECK(app_write_REG_SEGMENTS(segments));
+	start_queued_segments();
+	
+	run_checked_move();
+	
+	CHECK_EQUAL(500, get_motor_position());
+	CHECK_EQUAL(500, mock_pulses);
+	CHECK_EQUAL(1, direction_changes);
+	CHECK_EQUAL(SEGMENT_QUEUE_SIZE, get_segment_queue_space());
+}
+
+/************************************************************************/
+/* Velocity mode                                                        */
+/************************************************************************/
+/* The 1 ms callback of app.c ramps the velocity, the periods between   */
+/* two callbacks are checked.                                           */
+static double slowest_us;
+static double fastest_us;
+
+static void run_velocity (uint32_t ms)
+{
+	uint64_t end = mock_cycles + (uint64_t)ms * 32000;
+	uint64_t next_update = mock_cycles + 32000;
+	double period;
+	
+	slowest_us = 0;
+	fastest_us = 0;
+	
+	while (mock_cycles < end)
+	{
+		period = test_period_us();
+	
+		if (!mock_run_period())
+			return;
+	
+		if (slowest_us == 0 || period > slowest_us)
+			slowest_us = period;
+	
+		if (fastest_us == 0 || period < fastest_us)
+			fastest_us = period;
+	
+		if (get_motor_position() != mock_pulses)
+			position_mismatches++;
+	
+		while (mock_cycles >= next_update)
+		{
+			update_velocity_mode();
+			next_update += 32000;
+		}
+	}
+}
+
+static void test_velocity_below_start (void)
+{
+	int16_t velocity;
+	int32_t pulses;
+	
+	test_reset_device();
+	reset_checks();
+	
+	/* 100 steps/s is below the initial interval of 2000 us, no ramp at all */
+	velocity = 100;
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	CHECK(fabs(test_period_us() - 10000) < 5);
+	
+	run_velocity(500);
+	CHECK(fabs(slowest_us - 10000) < 5);
+	CHECK(fabs(fastest_us - 10000) < 5);
+	CHECK(mock_pulses >= 49 && mock_pulses <= 51);
+	
+	/* Turns around right away */
+	pulses = mock_pulses;
+	velocity = -100;
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	
+	run_velocity(500);
+	CHECK(fabs(slowest_us - 10000) < 5);
+	CHECK(mock_pulses < pulses - 45);
+	
+	/* Ramps from the initial speed up to the target */
+	velocity = 1000;
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	
+	run_velocity(500);
+	CHECK(fabs(test_period_us() - 1000) < 5);
+	
+	/* And back down to it, then straight to the target */
+	velocity = 100;
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	
+	run_velocity(100);
+	run_velocity(500);
+	CHECK(fabs(slowest_us - 10000) < 5);
+	CHECK(fabs(fastest_us - 10000) < 5);
+	
+	velocity = 0;
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	
+	run_velocity(500);
+	CHECK_EQUAL(0, mock_period_cycles());
+	CHECK_EQUAL(0, position_mismatches);
+}
+
+/* The fastest velocity with the fastest acceleration, the last ramp */
+/* step of each direction would overflow the velocity                 */
+static void test_velocity_fastest (void)
+{
+	int16_t velocity = 32767;
+	uint32_t nominal = 20;
+	uint32_t acceleration = 1000000;
+	int32_t pulses;
+	
+	test_reset_device();
+	reset_checks();
+	
+	CHECK(app_write_REG_NOMINAL_PULSE_INTERVAL(&nominal));
+	CHECK(app_write_REG_ACCELERATION(&acceleration));
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	
+	/* 15 ticks of 2 us */
+	run_velocity(100);
+	run_velocity(100);
+	CHECK(fabs(slowest_us - 30) < 0.1);
+	CHECK(fabs(fastest_us - 30) < 0.1);
+	CHECK(mock_pulses > 3000);
+	
+	pulses = mock_pulses;
+	velocity = -32767;
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	
+	run_velocity(100);
+	run_velocity(100);
+	CHECK(fabs(slowest_us - 30) < 0.1);
+	CHECK(fabs(fastest_us - 30) < 0.1);
+	CHECK(mock_pulses < pulses - 3000);
+	
+	velocity = 0;
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	
+	run_velocity(100);
+	CHECK_EQUAL(0, mock_period_cycles());
+	CHECK_EQUAL(0, position_mismatches);
+}
+
+/************************************************************************/
+/* Closed loop                                                          */
+/************************************************************************/
+static void test_closed_loop_deadband (void)
+{
+	/* 4 steps for each encoder count */
+	test_reset_device();
+	update_steps_per_count(4 << 8);
+	update_closed_loop_gains(128, 16);
+	set_closed_loop(true, 0);
+	
+	start_rotation(3);
+	mock_run_move(1000);
+	
+	/* Within one count of the encoder, nothing is corrected or integrated */
+	for (uint8_t i = 0; i < 100; i++)
+	{
+		CHECK_EQUAL(0, update_closed_loop(0));
+	}
+	
+	CHECK_EQUAL(3, get_position_error());
+	
+	/* Only this error is integrated, (128*5 + 16*5 + 128) >> 8 */
+	start_rotation(2);
+	mock_run_move(1000);
+	
+	CHECK_EQUAL(3, update_closed_loop(0));
+	
+	/* The steps seen by the encoder */
+	CHECK_EQUAL(0, update_closed_loop(1));
+	
+	set_closed_loop(false, 0);
+}
+
+/************************************************************************/
+/* Encoder velocity                                                     */
+/************************************************************************/
+/* The edges of phase A, 2 counts apart, timed with the 32 us ticks of  */
+/* the Harp timestamp and read by the 1 ms callback                     */
+static void test_encoder_edge_velocity (void)
+{
+	double edge_us = 2 * 1000000.0 / 6000;
+	double next_edge_us = edge_us;
+	int32_t velocity = 0;
+	
+	TCD1.CNT = 0x8000;
+	reset_encoder_velocity();
+	
+	for (uint16_t ms = 1; ms <= 200; ms++)
+	{
+		while (next_edge_us <= ms * 1000.0)
+		{
+			TCD1.CNT += 2;
+			capture_encoder_edge((uint32_t)(next_edge_us / 32));
+			next_edge_us += edge_us;
+		}
+	
+		velocity = update_encoder_velocity(ms * 1000 / 32);
+	
+		/* Timed over at least 4 ms, within the error of one tick */
+		if (ms > 10)
+			CHECK(fabs(velocity / 256.0 - 6000) < 6000 * 0.01);
+	}
+	
+	/* Without edges, bounded by one edge over the time since the last one */
+	velocity = update_encoder_velocity(210 * 1000 / 32);
+	CHECK(velocity <= 2 * 256 * 1000 / 10);
+	
+	velocity = update_encoder_velocity(2300 * 1000 / 32);
+	CHECK_EQUAL(0, velocity);
+}
+
+int main (void)
+{
+	RUN_TEST(test_reversal);
+	RUN_TEST(test_extended_move);
+	RUN_TEST(test_motion_command_during_move);
+	RUN_TEST(test_back_to_back_requests);
+	RUN_TEST(test_scheduled_requests);
+	RUN_TEST(test_move_to);
+	RUN_TEST(test_segments);
+	RUN_TEST(test_velocity_below_start);
+	RUN_TEST(test_velocity_fastest);
+	RUN_TEST(test_closed_loop_deadband);
+	RUN_TEST(test_encoder_edge_velocity);
+	
+	return test_failures != 0;
+}
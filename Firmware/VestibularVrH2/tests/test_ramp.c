@@ -0,0 +1,398 @@
+#include <math.h>
+#include "test.h"
+#include "app_ios_and_regs.h"
+#include "stepper_motor.h"
+
+/************************************************************************/
+/* Ramps                                                                */
+/************************************************************************/
+/* The periods of a whole move are recorded, one for each pulse, and    */
+/* checked against the shape of the profile: a monotonic acceleration   */
+/* from the initial interval to the nominal one, and a deceleration     */
+/* that mirrors it.                                                     */
+#define MAX_PULSES 60000
+
+static double periods[MAX_PULSES];
+
+static uint32_t run_recorded_move (int32_t steps)
+{
+	uint32_t n = 0;
+	
+	start_rotation(steps);
+	
+	while (mock_period_cycles() && n < MAX_PULSES)
+	{
+		periods[n++] = test_period_us();
+		mock_run_period();
+	}
+	
+	return n;
+}
+
+static void check_ramp_shape (uint32_t n, double initial_us, double nominal_us)
+{
+	uint32_t fastest = 0;
+	
+	for (uint32_t i = 1; i < n; i++)
+	{
+		if (periods[i] < periods[fastest])
+			fastest = i;
+	}
+	
+	/* Resolution of the TCC0 prescaler */
+	CHECK(fabs(periods[0] - initial_us) <= initial_us / 1000 + 0.1);
+	CHECK(fabs(periods[fastest] - nominal_us) <= nominal_us / 1000 + 0.1);
+	CHECK(fabs(periods[n - 1] - initial_us) <= initial_us / 1000 + 0.1);
+	
+	/* Never faster than the nominal speed, never slower than the initial one */
+	for (uint32_t i = 0; i < n; i++)
+	{
+		if (periods[i] < nominal_us - 0.1 || periods[i] > initial_us + initial_us / 1000 + 0.1)
+		{
+			CHECK(periods[i] >= nominal_us - 0.1 && periods[i] <= initial_us + initial_us / 1000 + 0.1);
+			break;
+		}
+	}
+	
+	/* Speeds up until the fastest pulse and slows down after it */
+	for (uint32_t i = 1; i <= fastest; i++)
+	{
+		if (periods[i] > periods[i - 1])
+		{
+			CHECK_EQUAL(0, i);
+			break;
+		}
+	}
+	
+	for (uint32_t i = fastest + 1; i < n; i++)
+	{
+		if (periods[i] < periods[i - 1])
+		{
+			CHECK_EQUAL(0, i);
+			break;
+		}
+	}
+	
+	/* The step n from the end runs at the same period as the step n */
+	for (uint32_t i = 0; i < n / 2; i++)
+	{
+		if (fabs(periods[i] - periods[n - 1 - i]) > 0.1)
+		{
+			CHECK_EQUAL(i, n - 1 - i);
+			break;
+		}
+	}
+}
+
+static void test_linear_ramp (void)
+{
+	uint32_t n;
+	uint32_t ramp_steps = 0;
+	
+	test_reset_device();
+	
+	n = run_recorded_move(2000);
+	
+	CHECK_EQUAL(2000, n);
+	CHECK_EQUAL(2000, mock_pulses);
+	CHECK_EQUAL(2000, get_motor_position());
+	check_ramp_shape(n, 2000, 250);
+	
+	/* 10 us shorter each step, (2000 - 250) / 10 steps */
+	for (uint32_t i = 1; i < n && periods[i] > 250.05; i++)
+	{
+		ramp_steps++;
+	
+		if (fabs(periods[i - 1] - periods[i] - 10) > 0.1)
+		{
+			CHECK_EQUAL(i, 0);
+			break;
+		}
+	}
+	
+	CHECK(ramp_steps >= 174 && ramp_steps <= 175);
+}
+
+static void test_long_linear_ramp (void)
+{
+	uint32_t n;
+	
+	/* 4875 steps of ramp, sub-sampled by 32 in the table */
+	test_reset_device();
+	update_motion_parameters(250, 10000, 2, 50, GM_PROFILE_LINEAR, 40000, 2000000);
+	mock_main_loop();
+	
+	n = run_recorded_move(12000);
+	
+	CHECK_EQUAL(12000, n);
+	CHECK_EQUAL(12000, get_motor_position());
+	check_ramp_shape(n, 10000, 250);
+	
+	/* Interpolated between the entries, never more than 2 us shorter each step */
+	for (uint32_t i = 1; i < n && periods[i] > 250.3; i++)
+	{
+		if (periods[i - 1] - periods[i] <= 0 || periods[i - 1] - periods[i] > 2.3)
+		{
+			CHECK_EQUAL(i, 0);
+			break;
+		}
+	}
+}
+
+/* At both ends of an S-curve the acceleration is bound by the jerk: it */
+/* grows from zero as jerk*t after the start and lands on zero as       */
+/* sqrt(2*jerk*dv) before the nominal speed. A step changes the speed,  */
+/* and so its period, by a/v^2 = a*T^2 relative to it. The chords       */
+/* between the entries of the table get twice that, plus one tick.      */
+static double s_curve_max_change (double acceleration, double period_us)
+{
+	double period = period_us / 1e6;
+	
+	return 2 * acceleration * period * period + 1 / (32 * period_us);
+}
+
+static void check_s_curve_ends (uint32_t n, double nominal_us, double acceleration, double jerk)
+{
+	uint32_t ramp_end;
+	double time = 0;
+	double a;
+	
+	for (ramp_end = 0; ramp_end < n / 2 && periods[ramp_end] > nominal_us + 0.05; ramp_end++);
+	
+	CHECK(ramp_end > 64);
+	
+	for (uint32_t i = 1; i < ramp_end; i++)
+	{
+		double change = fabs(periods[i] / periods[i - 1] - 1);
+	
+		time += periods[i - 1] / 1e6;
+	
+		if (i <= 32)
+		{
+			a = jerk * (time + periods[i] / 1e6);
+			a = (a < acceleration) ? a : acceleration;
+		}
+		else if (i >= ramp_end - 32)
+		{
+			a = sqrt(2 * jerk * (1e6 / nominal_us - 1e6 / periods[i - 1]));
+		}
+		else
+		{
+			continue;
+		}
+	
+		if (change > s_curve_max_change(a, periods[i - 1]))
+		{
+			printf("step %u: %.2f us to %.2f us\n", i, periods[i - 1], periods[i]);
+			CHECK(change <= s_curve_max_change(a, periods[i - 1]));
+			break;
+		}
+	}
+}
+
+static void test_s_curve_ramp (void)
+{
+	uint32_t n;
+	
+	test_reset_device();
+	update_profile_type(GM_PROFILE_S_CURVE);
+	mock_main_loop();
+	
+	n = run_recorded_move(3000);
+	
+	CHECK_EQUAL(3000, n);
+	CHECK_EQUAL(3000, get_motor_position());
+	check_ramp_shape(n, 2000, 250);
+	check_s_curve_ends(n, 250, 40000, 2000000);
+	
+	/* About 12500 steps, integrated in blocks of 128 steps */
+	test_reset_device();
+	update_motion_parameters(100, 2000, 10, 50, GM_PROFILE_S_CURVE, 4000, 200000);
+	mock_main_loop();
+	
+	n = run_recorded_move(30000);
+	
+	CHECK_EQUAL(30000, n);
+	check_ramp_shape(n, 2000, 100);
+	check_s_curve_ends(n, 100, 4000, 200000);
+}
+
+static void test_constant_acceleration_ramp (void)
+{
+	uint32_t n;
+	
+	test_reset_device();
+	update_profile_type(GM_PROFILE_CONSTANT_ACCELERATION);
+	mock_main_loop();
+	
+	n = run_recorded_move(3000);
+	
+	CHECK_EQUAL(3000, n);
+	CHECK_EQUAL(3000, get_motor_position());
+	check_ramp_shape(n, 2000, 250);
+}
+
+static void test_slow_initial_interval (void)
+{
+	uint32_t n;
+	
+	/* From 1 step/s at DIV1024 up to 50 ticks of it, about 200 steps */
+	test_reset_device();
+	update_motion_parameters(1600, 1000000, 10, 50, GM_PROFILE_CONSTANT_ACCELERATION, 1000, 2000000);
+	mock_main_loop();
+	
+	n = run_recorded_move(1000);
+	
+	CHECK_EQUAL(1000, n);
+	CHECK_EQUAL(1000, get_motor_position());
+	check_ramp_shape(n, 1000000, 1600);
+}
+
+static double step_index_from_rest (double period_us, double acceleration)
+{
+	/* Step n lasts sqrt(2*(n+1)/a) - sqrt(2*n/a) */
+	double r = period_us / 1e6 * sqrt(acceleration / 2);
+	double root = (1 - r * r) / (2 * r);
+	
+	return root * root;
+}
+
+static void test_constant_acceleration_curve (void)
+{
+	uint32_t n;
+	uint32_t ramp_end;
+	double root = sqrt(2.0 / 2000);
+	double first_step_n = step_index_from_rest(2000, 2000);
+	double ideal;
+	double ramp_us = 0;
+	double max_error = 0;
+	
+	/* About 24900 steps at 2000 steps/s^2, an entry every 128 steps in the table */
+	test_reset_device();
+	update_motion_parameters(100, 2000, 10, 50, GM_PROFILE_CONSTANT_ACCELERATION, 2000, 2000000);
+	mock_main_loop();
+	
+	n = run_recorded_move(55000);
+	
+	CHECK_EQUAL(55000, n);
+	CHECK_EQUAL(55000, get_motor_position());
+	check_ramp_shape(n, 2000, 100);
+	
+	for (ramp_end = 0; periods[ramp_end] > 100.05; ramp_end++);
+	
+	/* Velocity of each step against the ideal one */
+	for (uint32_t i = 0; i < ramp_end; i++)
+	{
+		ideal = 1e6 * root * (sqrt(first_step_n + i + 1) - sqrt(first_step_n + i));
+		ramp_us += periods[i];
+		
+		/* Never faster, the chords between the entries are above the curve */
+		if (periods[i] < ideal * 0.999)
+		{
+			CHECK_EQUAL(0, i);
+			break;
+		}
+		
+		/* The first chords, where the curve bends the most, are left out */
+		if (i >= 4 * 128 && fabs(ideal / periods[i] - 1) > max_error)
+			max_error = fabs(ideal / periods[i] - 1);
+	}
+	
+	CHECK(max_error < 0.005);
+	
+	/* Exact number of steps, within an entry, and time to the nominal speed */
+	ideal = 1e6 * root * (sqrt(first_step_n + ramp_end) - sqrt(first_step_n));
+	
+	CHECK(fabs(ramp_end - (step_index_from_rest(100, 2000) - first_step_n)) <= 128);
+	CHECK(fabs(ramp_us / ideal - 1) < 0.005);
+}
+
+static void test_triangular_profile (void)
+{
+	uint32_t n;
+	
+	/* Too short to reach the nominal speed */
+	test_reset_device();
+	
+	n = run_recorded_move(-60);
+	
+	CHECK_EQUAL(60, n);
+	CHECK_EQUAL(-60, mock_pulses);
+	CHECK_EQUAL(-60, get_motor_position());
+	
+	for (uint32_t i = 0; i < n / 2; i++)
+	{
+		CHECK(periods[i] > 250);
+		CHECK(fabs(periods[i] - periods[n - 1 - i]) <= 0.1);
+	}
+}
+
+/************************************************************************/
+/* Move time                                                            */
+/************************************************************************/
+/* The step ISR before the ramp table changed TCC0_PER by the step      */
+/* interval on every overflow. The table must give the same pulses, so  */
+/* the moves take the same number of CPU cycles.                        */
+static double reference_move_us (uint32_t steps, double initial_us, double nominal_us, double step_us)
+{
+	uint32_t ramp_steps = (initial_us - nominal_us) / step_us;
+	uint32_t remaining;
+	double period = initial_us;
+	double total = 0;
+	
+	for (uint32_t count = 1; count <= steps; count++)
+	{
+		total += period;
+		remaining = steps - count;
+		
+		if (remaining <= count && remaining <= ramp_steps)
+			period = (period + step_us > initial_us) ? initial_us : period + step_us;
+		else
+			period = (period - step_us < nominal_us) ? nominal_us : period - step_us;
+	}
+	
+	return total;
+}
+
+static void check_move_cycles (int32_t steps, uint32_t initial_us, uint32_t nominal_us, uint16_t step_us)
+{
+	double reference = reference_move_us(steps, initial_us, nominal_us, step_us) * 32;
+	
+	test_reset_device();
+	update_motion_parameters(nominal_us, initial_us, step_us, 50, GM_PROFILE_LINEAR, 40000, 2000000);
+	mock_main_loop();
+	
+	start_rotation(steps);
+	mock_run_move(100000);
+	
+	CHECK_EQUAL(steps, mock_pulses);
+	
+	/* The ramps may end one step apart, within one initial interval */
+	if (fabs(mock_cycles - reference) > initial_us * 32)
+	{
+		printf("%d steps: %.0f cycles, expected %.0f\n", steps, (double)mock_cycles, reference);
+		CHECK(0);
+	}
+}
+
+static void test_move_cycles (void)
+{
+	check_move_cycles(2000, 2000, 250, 10);
+	check_move_cycles(60, 2000, 250, 10);
+	check_move_cycles(12000, 10000, 250, 2);
+	check_move_cycles(40000, 60000, 100, 2);
+}
+
+int main (void)
+{
+	RUN_TEST(test_linear_ramp);
+	RUN_TEST(test_long_linear_ramp);
+	RUN_TEST(test_s_curve_ramp);
+	RUN_TEST(test_constant_acceleration_ramp);
+	RUN_TEST(test_slow_initial_interval);
+	RUN_TEST(test_constant_acceleration_curve);
+	RUN_TEST(test_triangular_profile);
+	RUN_TEST(test_move_cycles);
+	
+	return test_failures != 0;
+}
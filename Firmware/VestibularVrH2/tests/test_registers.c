@@ -0,0 +1,315 @@
+#include "test.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+#include "stepper_motor.h"
+#include "external_control.h"
+#include <util/crc16.h>
+
+extern AppRegs app_regs;
+extern uint8_t external_ring[EXTERNAL_RING_SIZE];
+
+/************************************************************************/
+/* Register validation                                                  */
+/************************************************************************/
+/* The write functions return false, and keep the register, when the   */
+/* value is out of range or the motor is busy with another kind of move. */
+static void test_pulse_intervals (void)
+{
+	uint32_t interval;
+	uint16_t step;
+	int32_t command[8] = {0, 1000, 1000000, 10, 50, GM_PROFILE_LINEAR, 40000, 2000000};
+	
+	test_reset_device();
+	
+	interval = 19;
+	CHECK(!app_write_REG_NOMINAL_PULSE_INTERVAL(&interval));
+	interval = 2000001;
+	CHECK(!app_write_REG_NOMINAL_PULSE_INTERVAL(&interval));
+	CHECK(!app_write_REG_INITIAL_PULSE_INTERVAL(&interval));
+	CHECK_EQUAL(250, app_regs.REG_NOMINAL_PULSE_INTERVAL);
+	CHECK_EQUAL(2000, app_regs.REG_INITIAL_PULSE_INTERVAL);
+	
+	interval = 300;
+	CHECK(app_write_REG_NOMINAL_PULSE_INTERVAL(&interval));
+	CHECK_EQUAL(300, app_regs.REG_NOMINAL_PULSE_INTERVAL);
+	
+	/* Both must fit the TCC0 prescaler of the initial interval, DIV1024 */
+	/* above 524287 us, where the nominal one needs 50 ticks of 32 us    */
+	interval = 1000000;
+	CHECK(!app_write_REG_INITIAL_PULSE_INTERVAL(&interval));
+	CHECK_EQUAL(2000, app_regs.REG_INITIAL_PULSE_INTERVAL);
+	
+	interval = 1600;
+	CHECK(app_write_REG_NOMINAL_PULSE_INTERVAL(&interval));
+	interval = 1000000;
+	CHECK(app_write_REG_INITIAL_PULSE_INTERVAL(&interval));
+	interval = 1599;
+	CHECK(!app_write_REG_NOMINAL_PULSE_INTERVAL(&interval));
+	CHECK_EQUAL(1600, app_regs.REG_NOMINAL_PULSE_INTERVAL);
+	
+	/* Same with all the parameters at once */
+	CHECK(!app_write_REG_MOTION_COMMAND(command));
+	
+	step = 1;
+	CHECK(!app_write_REG_PULSE_STEP_INTERVAL(&step));
+	step = 2001;
+	CHECK(!app_write_REG_PULSE_STEP_INTERVAL(&step));
+	
+	step = 9;
+	CHECK(!app_write_REG_PULSE_PERIOD(&step));
+	step = 1001;
+	CHECK(!app_write_REG_PULSE_PERIOD(&step));
+}
+
+static void test_profile_parameters (void)
+{
+	uint8_t profile;
+	uint32_t value;
+	
+	test_reset_device();
+	
+	profile = GM_PROFILE_CONSTANT_ACCELERATION + 1;
+	CHECK(!app_write_REG_PROFILE_TYPE(&profile));
+	profile = GM_PROFILE_S_CURVE;
+	CHECK(app_write_REG_PROFILE_TYPE(&profile));
+	
+	value = 9;
+	CHECK(!app_write_REG_ACCELERATION(&value));
+	value = 1000001;
+	CHECK(!app_write_REG_ACCELERATION(&value));
+	
+	value = 9;
+	CHECK(!app_write_REG_JERK(&value));
+	value = 100000001;
+	CHECK(!app_write_REG_JERK(&value));
+	
+	/* The ramp parameters can change during a ramped move */
+	start_rotation(2000);
+	mock_run_move(100);
+	
+	value = 20000;
+	CHECK(app_write_REG_ACCELERATION(&value));
+	mock_run_move(100000);
+	CHECK_EQUAL(2000, get_motor_position());
+}
+
+static void test_busy_motor (void)
+{
+	int16_t interval = 500;
+	int16_t velocity = 100;
+	int32_t position = 10;
+	uint32_t nominal = 300;
+	int32_t segments[8] = {100, 0, 0, 0, 0, 0, 0, 0};
+	
+	test_reset_device();
+	
+	/* The immediate pulses only accept a new interval or a stop */
+	CHECK(app_write_REG_IMMEDIATE_PULSES(&interval));
+	CHECK_EQUAL(500 * 32, mock_period_cycles());
+	CHECK(!app_write_REG_NOMINAL_PULSE_INTERVAL(&nominal));
+	CHECK(!app_write_REG_MOVE_TO(&position));
+	CHECK(!app_write_REG_SEGMENTS(segments));
+	CHECK(!app_write_REG_POSITION(&position));
+	CHECK(!app_write_REG_VELOCITY(&velocity));
+	
+	/* Too long for the prescaler of the last interval */
+	interval = -30000;
+	CHECK(app_write_REG_IMMEDIATE_PULSES(&interval));
+	CHECK_EQUAL(30000 * 32, mock_period_cycles());
+	
+	interval = 5;
+	CHECK(!app_write_REG_IMMEDIATE_PULSES(&interval));
+	
+	interval = 0;
+	CHECK(app_write_REG_IMMEDIATE_PULSES(&interval));
+	CHECK_EQUAL(0, mock_period_cycles());
+	
+	/* The velocity mode */
+	CHECK(app_write_REG_VELOCITY(&velocity));
+	CHECK(!app_write_REG_MOVE_TO(&position));
+	CHECK(!app_write_REG_SEGMENTS(segments));
+	CHECK(!app_write_REG_POSITION(&position));
+	
+	velocity = 0;
+	CHECK(app_write_REG_VELOCITY(&velocity));
+}
+
+static void test_motion_registers (void)
+{
+	int16_t velocity;
+	int32_t position = 100;
+	uint8_t control = B_DISABLE_MOTOR;
+	int32_t segments[8] = {100, 200, 0, 0, 0, 0, 0, 0};
+	
+	test_reset_device();
+	
+	/* Limited to the nominal speed */
+	velocity = 4001;
+	CHECK(!app_write_REG_VELOCITY(&velocity));
+	velocity = -4001;
+	CHECK(!app_write_REG_VELOCITY(&velocity));
+	
+	/* Segments faster than the nominal speed */
+	CHECK(!app_write_REG_SEGMENTS(segments));
+	segments[1] = 2001;
+	CHECK(!app_write_REG_SEGMENTS(segments));
+	CHECK_EQUAL(SEGMENT_QUEUE_SIZE, get_segment_queue_space());
+	
+	/* The position is only set while stopped */
+	CHECK(app_write_REG_POSITION(&position));
+	CHECK_EQUAL(100, get_motor_position());
+	
+	start_rotation(500);
+	CHECK(!app_write_REG_POSITION(&position));
+	mock_run_move(100000);
+	
+	/* Nothing moves with the motor disabled */
+	app_write_REG_CONTROL(&control);
+	app_regs.REG_CONTROL = control;
+	
+	CHECK(!app_write_REG_MOVE_TO(&position));
+	CHECK(!app_write_REG_VELOCITY(&velocity));
+	CHECK_EQUAL(0, mock_period_cycles());
+}
+
+/* The registers only ask for a new ramp table, the main loop builds it */
+/* and a move requested meanwhile waits for it                          */
+static void test_ramp_build (void)
+{
+	uint32_t initial = 4000;
+	int32_t pulses = 100;
+	int16_t velocity = 100;
+	
+	test_reset_device();
+	
+	CHECK(app_write_REG_INITIAL_PULSE_INTERVAL(&initial));
+	CHECK(get_ramp_building());
+	
+	/* Other kinds of moves can't start before the waiting one */
+	CHECK(app_write_REG_PULSES(&pulses));
+	CHECK_EQUAL(0, mock_period_cycles());
+	CHECK(!app_write_REG_VELOCITY(&velocity));
+	
+	mock_main_loop();
+	CHECK(!get_ramp_building());
+	CHECK_EQUAL(4000 * 32, mock_period_cycles());
+	
+	mock_run_move(100000);
+	CHECK_EQUAL(100, mock_pulses);
+	CHECK_EQUAL(100, get_motor_position());
+}
+
+static void test_external_baud_rate (void)
+{
+	uint32_t baud_rate;
+	
+	test_reset_device();
+	
+	baud_rate = 0;
+	CHECK(!app_write_REG_EXTERNAL_BAUD_RATE(&baud_rate));
+	
+	/* 4 MHz / 3 is 11 % away */
+	baud_rate = 1500000;
+	CHECK(!app_write_REG_EXTERNAL_BAUD_RATE(&baud_rate));
+	
+	baud_rate = 115200;
+	CHECK(app_write_REG_EXTERNAL_BAUD_RATE(&baud_rate));
+	CHECK_EQUAL(34, USARTD0_BAUDCTRLA);
+}
+
+/************************************************************************/
+/* Framed external control                                              */
+/************************************************************************/
+/* The bytes are written to the ring as DMA channel 3 does, with the    */
+/* transaction flag set each time it wraps. The flag clears on a write  */
+/* of one, so it is cleared here after each poll.                       */
+static uint8_t ring_head;
+
+static void receive_external (const uint8_t *bytes, uint8_t length)
+{
+	for (uint8_t i = 0; i < length; i++)
+	{
+		external_ring[ring_head] = bytes[i];
+		ring_head = (ring_head + 1) & (EXTERNAL_RING_SIZE - 1);
+		
+		if (ring_head == 0)
+			DMA_INTFLAGS |= DMA_CH3TRNIF_bm;
+	}
+	
+	DMA_CH3_TRFCNT = EXTERNAL_RING_SIZE - ring_head;
+}
+
+static void poll_external (void)
+{
+	poll_external_control();
+	DMA_INTFLAGS = 0;
+}
+
+static void receive_frame (uint8_t sequence, uint8_t length)
+{
+	uint8_t frame[EXTERNAL_FRAME_SIZE] = {EXTERNAL_FRAME_SYNC, sequence, EXTERNAL_COMMAND_ACCELERATION, 0xE8, 0x03, 0, 0};
+	uint16_t crc = 0xFFFF;
+	
+	for (uint8_t i = 0; i < EXTERNAL_FRAME_SIZE - 2; i++)
+	{
+		crc = _crc_xmodem_update(crc, frame[i]);
+	}
+	
+	frame[7] = crc & 0xFF;
+	frame[8] = crc >> 8;
+	
+	receive_external(frame, length);
+}
+
+static void test_external_overrun (void)
+{
+	uint8_t flood[EXTERNAL_RING_SIZE] = {0};
+	uint16_t statistics[EXTERNAL_STATISTICS_LENGTH];
+	
+	test_reset_device();
+	start_external_control(GM_EXTERNAL_FRAMED);
+	reset_external_statistics();
+	ring_head = 0;
+	DMA_INTFLAGS = 0;
+	
+	receive_frame(1, EXTERNAL_FRAME_SIZE);
+	poll_external();
+	
+	/* A whole ring received between two polls, over a partial frame */
+	receive_frame(2, 4);
+	poll_external();
+	receive_external(flood, EXTERNAL_RING_SIZE);
+	poll_external();
+	
+	get_external_statistics(statistics);
+	CHECK_EQUAL(1, statistics[EXTERNAL_STATISTICS_FRAMES]);
+	CHECK_EQUAL(1, statistics[EXTERNAL_STATISTICS_OVERRUNS]);
+	
+	/* The partial frame is dropped, the next ones wrap the ring normally */
+	for (uint8_t sequence = 3; sequence < 10; sequence++)
+	{
+		receive_frame(sequence, EXTERNAL_FRAME_SIZE);
+		poll_external();
+	}
+	
+	get_external_statistics(statistics);
+	CHECK_EQUAL(8, statistics[EXTERNAL_STATISTICS_FRAMES]);
+	CHECK_EQUAL(0, statistics[EXTERNAL_STATISTICS_CRC_ERRORS]);
+	CHECK_EQUAL(1, statistics[EXTERNAL_STATISTICS_LOST_FRAMES]);
+	CHECK_EQUAL(1, statistics[EXTERNAL_STATISTICS_OVERRUNS]);
+	
+	start_external_control(GM_EXTERNAL_LEGACY);
+}
+
+int main (void)
+{
+	RUN_TEST(test_pulse_intervals);
+	RUN_TEST(test_profile_parameters);
+	RUN_TEST(test_busy_motor);
+	RUN_TEST(test_motion_registers);
+	RUN_TEST(test_ramp_build);
+	RUN_TEST(test_external_baud_rate);
+	RUN_TEST(test_external_overrun);
+	
+	return test_failures != 0;
+}
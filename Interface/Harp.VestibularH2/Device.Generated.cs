@@ -47,7 +47,40 @@ namespace Harp.VestibularH2
             { 39, typeof(AnalogInput) },
             { 40, typeof(StopSwitch) },
             { 41, typeof(MotorState) },
-            { 42, typeof(ImmediatePulses) }
+            { 42, typeof(ImmediatePulses) },
+            { 43, typeof(ProfileType) },
+            { 44, typeof(Acceleration) },
+            { 45, typeof(Jerk) },
+            { 46, typeof(Segments) },
+            { 47, typeof(SegmentQueueSpace) },
+            { 48, typeof(Position) },
+            { 49, typeof(MoveTo) },
+            { 50, typeof(Velocity) },
+            { 51, typeof(ClosedLoop) },
+            { 52, typeof(StepsPerCount) },
+            { 53, typeof(ClosedLoopGains) },
+            { 54, typeof(PositionError) },
+            { 55, typeof(WaveformLength) },
+            { 56, typeof(WaveformSamples) },
+            { 57, typeof(WaveformSampleInterval) },
+            { 58, typeof(WaveformControl) },
+            { 59, typeof(OscillationAmplitude) },
+            { 60, typeof(OscillationFrequency) },
+            { 61, typeof(OscillationPhase) },
+            { 62, typeof(OscillationCycles) },
+            { 63, typeof(StepGenerator) },
+            { 64, typeof(HardwareCruise) },
+            { 65, typeof(IsrStatistics) },
+            { 66, typeof(TraceControl) },
+            { 67, typeof(TraceSteps) },
+            { 68, typeof(TraceIndex) },
+            { 69, typeof(TraceData) },
+            { 70, typeof(ScheduledStart) },
+            { 71, typeof(MotionCommand) },
+            { 72, typeof(ExternalControl) },
+            { 73, typeof(ExternalBaudRate) },
+            { 74, typeof(ExternalStatistics) },
+            { 75, typeof(EncoderVelocity) }
         };
     }
 
@@ -87,6 +120,39 @@ namespace Harp.VestibularH2
     /// <seealso cref="StopSwitch"/>
     /// <seealso cref="MotorState"/>
     /// <seealso cref="ImmediatePulses"/>
+    /// <seealso cref="ProfileType"/>
+    /// <seealso cref="Acceleration"/>
+    /// <seealso cref="Jerk"/>
+    /// <seealso cref="Segments"/>
+    /// <seealso cref="SegmentQueueSpace"/>
+    /// <seealso cref="Position"/>
+    /// <seealso cref="MoveTo"/>
+    /// <seealso cref="Velocity"/>
+    /// <seealso cref="ClosedLoop"/>
+    /// <seealso cref="StepsPerCount"/>
+    /// <seealso cref="ClosedLoopGains"/>
+    /// <seealso cref="PositionError"/>
+    /// <seealso cref="WaveformLength"/>
+    /// <seealso cref="WaveformSamples"/>
+    /// <seealso cref="WaveformSampleInterval"/>
+    /// <seealso cref="WaveformControl"/>
+    /// <seealso cref="OscillationAmplitude"/>
+    /// <seealso cref="OscillationFrequency"/>
+    /// <seealso cref="OscillationPhase"/>
+    /// <seealso cref="OscillationCycles"/>
+    /// <seealso cref="StepGenerator"/>
+    /// <seealso cref="HardwareCruise"/>
+    /// <seealso cref="IsrStatistics"/>
+    /// <seealso cref="TraceControl"/>
+    /// <seealso cref="TraceSteps"/>
+    /// <seealso cref="TraceIndex"/>
+    /// <seealso cref="TraceData"/>
+    /// <seealso cref="ScheduledStart"/>
+    /// <seealso cref="MotionCommand"/>
+    /// <seealso cref="ExternalControl"/>
+    /// <seealso cref="ExternalBaudRate"/>
+    /// <seealso cref="ExternalStatistics"/>
+    /// <seealso cref="EncoderVelocity"/>
     [XmlInclude(typeof(Control))]
     [XmlInclude(typeof(Pulses))]
     [XmlInclude(typeof(NominalPulseInterval))]
@@ -98,6 +164,39 @@ namespace Harp.VestibularH2
     [XmlInclude(typeof(StopSwitch))]
     [XmlInclude(typeof(MotorState))]
     [XmlInclude(typeof(ImmediatePulses))]
+    [XmlInclude(typeof(ProfileType))]
+    [XmlInclude(typeof(Acceleration))]
+    [XmlInclude(typeof(Jerk))]
+    [XmlInclude(typeof(Segments))]
+    [XmlInclude(typeof(SegmentQueueSpace))]
+    [XmlInclude(typeof(Position))]
+    [XmlInclude(typeof(MoveTo))]
+    [XmlInclude(typeof(Velocity))]
+    [XmlInclude(typeof(ClosedLoop))]
+    [XmlInclude(typeof(StepsPerCount))]
+    [XmlInclude(typeof(ClosedLoopGains))]
+    [XmlInclude(typeof(PositionError))]
+    [XmlInclude(typeof(WaveformLength))]
+    [XmlInclude(typeof(WaveformSamples))]
+    [XmlInclude(typeof(WaveformSampleInterval))]
+    [XmlInclude(typeof(WaveformControl))]
+    [XmlInclude(typeof(OscillationAmplitude))]
+    [XmlInclude(typeof(OscillationFrequency))]
+    [XmlInclude(typeof(OscillationPhase))]
+    [XmlInclude(typeof(OscillationCycles))]
+    [XmlInclude(typeof(StepGenerator))]
+    [XmlInclude(typeof(HardwareCruise))]
+    [XmlInclude(typeof(IsrStatistics))]
+    [XmlInclude(typeof(TraceControl))]
+    [XmlInclude(typeof(TraceSteps))]
+    [XmlInclude(typeof(TraceIndex))]
+    [XmlInclude(typeof(TraceData))]
+    [XmlInclude(typeof(ScheduledStart))]
+    [XmlInclude(typeof(MotionCommand))]
+    [XmlInclude(typeof(ExternalControl))]
+    [XmlInclude(typeof(ExternalBaudRate))]
+    [XmlInclude(typeof(ExternalStatistics))]
+    [XmlInclude(typeof(EncoderVelocity))]
     [Description("Filters register-specific messages reported by the VestibularH2 device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -130,6 +229,39 @@ namespace Harp.VestibularH2
     /// <seealso cref="StopSwitch"/>
     /// <seealso cref="MotorState"/>
     /// <seealso cref="ImmediatePulses"/>
+    /// <seealso cref="ProfileType"/>
+    /// <seealso cref="Acceleration"/>
+    /// <seealso cref="Jerk"/>
+    /// <seealso cref="Segments"/>
+    /// <seealso cref="SegmentQueueSpace"/>
+    /// <seealso cref="Position"/>
+    /// <seealso cref="MoveTo"/>
+    /// <seealso cref="Velocity"/>
+    /// <seealso cref="ClosedLoop"/>
+    /// <seealso cref="StepsPerCount"/>
+    /// <seealso cref="ClosedLoopGains"/>
+    /// <seealso cref="PositionError"/>
+    /// <seealso cref="WaveformLength"/>
+    /// <seealso cref="WaveformSamples"/>
+    /// <seealso cref="WaveformSampleInterval"/>
+    /// <seealso cref="WaveformControl"/>
+    /// <seealso cref="OscillationAmplitude"/>
+    /// <seealso cref="OscillationFrequency"/>
+    /// <seealso cref="OscillationPhase"/>
+    /// <seealso cref="OscillationCycles"/>
+    /// <seealso cref="StepGenerator"/>
+    /// <seealso cref="HardwareCruise"/>
+    /// <seealso cref="IsrStatistics"/>
+    /// <seealso cref="TraceControl"/>
+    /// <seealso cref="TraceSteps"/>
+    /// <seealso cref="TraceIndex"/>
+    /// <seealso cref="TraceData"/>
+    /// <seealso cref="ScheduledStart"/>
+    /// <seealso cref="MotionCommand"/>
+    /// <seealso cref="ExternalControl"/>
+    /// <seealso cref="ExternalBaudRate"/>
+    /// <seealso cref="ExternalStatistics"/>
+    /// <seealso cref="EncoderVelocity"/>
     [XmlInclude(typeof(Control))]
     [XmlInclude(typeof(Pulses))]
     [XmlInclude(typeof(NominalPulseInterval))]
@@ -141,6 +273,39 @@ namespace Harp.VestibularH2
     [XmlInclude(typeof(StopSwitch))]
     [XmlInclude(typeof(MotorState))]
     [XmlInclude(typeof(ImmediatePulses))]
+    [XmlInclude(typeof(ProfileType))]
+    [XmlInclude(typeof(Acceleration))]
+    [XmlInclude(typeof(Jerk))]
+    [XmlInclude(typeof(Segments))]
+    [XmlInclude(typeof(SegmentQueueSpace))]
+    [XmlInclude(typeof(Position))]
+    [XmlInclude(typeof(MoveTo))]
+    [XmlInclude(typeof(Velocity))]
+    [XmlInclude(typeof(ClosedLoop))]
+    [XmlInclude(typeof(StepsPerCount))]
+    [XmlInclude(typeof(ClosedLoopGains))]
+    [XmlInclude(typeof(PositionError))]
+    [XmlInclude(typeof(WaveformLength))]
+    [XmlInclude(typeof(WaveformSamples))]
+    [XmlInclude(typeof(WaveformSampleInterval))]
+    [XmlInclude(typeof(WaveformControl))]
+    [XmlInclude(typeof(OscillationAmplitude))]
+    [XmlInclude(typeof(OscillationFrequency))]
+    [XmlInclude(typeof(OscillationPhase))]
+    [XmlInclude(typeof(OscillationCycles))]
+    [XmlInclude(typeof(StepGenerator))]
+    [XmlInclude(typeof(HardwareCruise))]
+    [XmlInclude(typeof(IsrStatistics))]
+    [XmlInclude(typeof(TraceControl))]
+    [XmlInclude(typeof(TraceSteps))]
+    [XmlInclude(typeof(TraceIndex))]
+    [XmlInclude(typeof(TraceData))]
+    [XmlInclude(typeof(ScheduledStart))]
+    [XmlInclude(typeof(MotionCommand))]
+    [XmlInclude(typeof(ExternalControl))]
+    [XmlInclude(typeof(ExternalBaudRate))]
+    [XmlInclude(typeof(ExternalStatistics))]
+    [XmlInclude(typeof(EncoderVelocity))]
     [XmlInclude(typeof(TimestampedControl))]
     [XmlInclude(typeof(TimestampedPulses))]
     [XmlInclude(typeof(TimestampedNominalPulseInterval))]
@@ -152,6 +317,39 @@ namespace Harp.VestibularH2
     [XmlInclude(typeof(TimestampedStopSwitch))]
     [XmlInclude(typeof(TimestampedMotorState))]
     [XmlInclude(typeof(TimestampedImmediatePulses))]
+    [XmlInclude(typeof(TimestampedProfileType))]
+    [XmlInclude(typeof(TimestampedAcceleration))]
+    [XmlInclude(typeof(TimestampedJerk))]
+    [XmlInclude(typeof(TimestampedSegments))]
+    [XmlInclude(typeof(TimestampedSegmentQueueSpace))]
+    [XmlInclude(typeof(TimestampedPosition))]
+    [XmlInclude(typeof(TimestampedMoveTo))]
+    [XmlInclude(typeof(TimestampedVelocity))]
+    [XmlInclude(typeof(TimestampedClosedLoop))]
+    [XmlInclude(typeof(TimestampedStepsPerCount))]
+    [XmlInclude(typeof(TimestampedClosedLoopGains))]
+    [XmlInclude(typeof(TimestampedPositionError))]
+    [XmlInclude(typeof(TimestampedWaveformLength))]
+    [XmlInclude(typeof(TimestampedWaveformSamples))]
+    [XmlInclude(typeof(TimestampedWaveformSampleInterval))]
+    [XmlInclude(typeof(TimestampedWaveformControl))]
+    [XmlInclude(typeof(TimestampedOscillationAmplitude))]
+    [XmlInclude(typeof(TimestampedOscillationFrequency))]
+    [XmlInclude(typeof(TimestampedOscillationPhase))]
+    [XmlInclude(typeof(TimestampedOscillationCycles))]
+    [XmlInclude(typeof(TimestampedStepGenerator))]
+    [XmlInclude(typeof(TimestampedHardwareCruise))]
+    [XmlInclude(typeof(TimestampedIsrStatistics))]
+    [XmlInclude(typeof(TimestampedTraceControl))]
+    [XmlInclude(typeof(TimestampedTraceSteps))]
+    [XmlInclude(typeof(TimestampedTraceIndex))]
+    [XmlInclude(typeof(TimestampedTraceData))]
+    [XmlInclude(typeof(TimestampedScheduledStart))]
+    [XmlInclude(typeof(TimestampedMotionCommand))]
+    [XmlInclude(typeof(TimestampedExternalControl))]
+    [XmlInclude(typeof(TimestampedExternalBaudRate))]
+    [XmlInclude(typeof(TimestampedExternalStatistics))]
+    [XmlInclude(typeof(TimestampedEncoderVelocity))]
     [Description("Filters and selects specific messages reported by the VestibularH2 device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -181,6 +379,39 @@ namespace Harp.VestibularH2
     /// <seealso cref="StopSwitch"/>
     /// <seealso cref="MotorState"/>
     /// <seealso cref="ImmediatePulses"/>
+    /// <seealso cref="ProfileType"/>
+    /// <seealso cref="Acceleration"/>
+    /// <seealso cref="Jerk"/>
+    /// <seealso cref="Segments"/>
+    /// <seealso cref="SegmentQueueSpace"/>
+    /// <seealso cref="Position"/>
+    /// <seealso cref="MoveTo"/>
+    /// <seealso cref="Velocity"/>
+    /// <seealso cref="ClosedLoop"/>
+    /// <seealso cref="StepsPerCount"/>
+    /// <seealso cref="ClosedLoopGains"/>
+    /// <seealso cref="PositionError"/>
+    /// <seealso cref="WaveformLength"/>
+    /// <seealso cref="WaveformSamples"/>
+    /// <seealso cref="WaveformSampleInterval"/>
+    /// <seealso cref="WaveformControl"/>
+    /// <seealso cref="OscillationAmplitude"/>
+    /// <seealso cref="OscillationFrequency"/>
+    /// <seealso cref="OscillationPhase"/>
+    /// <seealso cref="OscillationCycles"/>
+    /// <seealso cref="StepGenerator"/>
+    /// <seealso cref="HardwareCruise"/>
+    /// <seealso cref="IsrStatistics"/>
+    /// <seealso cref="TraceControl"/>
+    /// <seealso cref="TraceSteps"/>
+    /// <seealso cref="TraceIndex"/>
+    /// <seealso cref="TraceData"/>
+    /// <seealso cref="ScheduledStart"/>
+    /// <seealso cref="MotionCommand"/>
+    /// <seealso cref="ExternalControl"/>
+    /// <seealso cref="ExternalBaudRate"/>
+    /// <seealso cref="ExternalStatistics"/>
+    /// <seealso cref="EncoderVelocity"/>
     [XmlInclude(typeof(Control))]
     [XmlInclude(typeof(Pulses))]
     [XmlInclude(typeof(NominalPulseInterval))]
@@ -192,6 +423,39 @@ namespace Harp.VestibularH2
     [XmlInclude(typeof(StopSwitch))]
     [XmlInclude(typeof(MotorState))]
     [XmlInclude(typeof(ImmediatePulses))]
+    [XmlInclude(typeof(ProfileType))]
+    [XmlInclude(typeof(Acceleration))]
+    [XmlInclude(typeof(Jerk))]
+    [XmlInclude(typeof(Segments))]
+    [XmlInclude(typeof(SegmentQueueSpace))]
+    [XmlInclude(typeof(Position))]
+    [XmlInclude(typeof(MoveTo))]
+    [XmlInclude(typeof(Velocity))]
+    [XmlInclude(typeof(ClosedLoop))]
+    [XmlInclude(typeof(StepsPerCount))]
+    [XmlInclude(typeof(ClosedLoopGains))]
+    [XmlInclude(typeof(PositionError))]
+    [XmlInclude(typeof(WaveformLength))]
+    [XmlInclude(typeof(WaveformSamples))]
+    [XmlInclude(typeof(WaveformSampleInterval))]
+    [XmlInclude(typeof(WaveformControl))]
+    [XmlInclude(typeof(OscillationAmplitude))]
+    [XmlInclude(typeof(OscillationFrequency))]
+    [XmlInclude(typeof(OscillationPhase))]
+    [XmlInclude(typeof(OscillationCycles))]
+    [XmlInclude(typeof(StepGenerator))]
+    [XmlInclude(typeof(HardwareCruise))]
+    [XmlInclude(typeof(IsrStatistics))]
+    [XmlInclude(typeof(TraceControl))]
+    [XmlInclude(typeof(TraceSteps))]
+    [XmlInclude(typeof(TraceIndex))]
+    [XmlInclude(typeof(TraceData))]
+    [XmlInclude(typeof(ScheduledStart))]
+    [XmlInclude(typeof(MotionCommand))]
+    [XmlInclude(typeof(ExternalControl))]
+    [XmlInclude(typeof(ExternalBaudRate))]
+    [XmlInclude(typeof(ExternalStatistics))]
+    [XmlInclude(typeof(EncoderVelocity))]
     [Description("Formats a sequence of values as specific VestibularH2 register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -400,9 +664,9 @@ namespace Harp.VestibularH2
     }
 
     /// <summary>
-    /// Represents a register that sets the motor pulse interval when running at nominal speed.
+    /// Represents a register that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.
     /// </summary>
-    [Description("Sets the motor pulse interval when running at nominal speed.")]
+    [Description("Sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.")]
     public partial class NominalPulseInterval
     {
         /// <summary>
@@ -413,7 +677,7 @@ namespace Harp.VestibularH2
         /// <summary>
         /// Represents the payload type of the <see cref="NominalPulseInterval"/> register. This field is constant.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U16;
+        public const PayloadType RegisterType = PayloadType.U32;
 
         /// <summary>
         /// Represents the length of the <see cref="NominalPulseInterval"/> register. This field is constant.
@@ -425,9 +689,9 @@ namespace Harp.VestibularH2
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static ushort GetPayload(HarpMessage message)
+        public static uint GetPayload(HarpMessage message)
         {
-            return message.GetPayloadUInt16();
+            return message.GetPayloadUInt32();
         }
 
         /// <summary>
@@ -435,9 +699,9 @@ namespace Harp.VestibularH2
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
         {
-            return message.GetTimestampedPayloadUInt16();
+            return message.GetTimestampedPayloadUInt32();
         }
 
         /// <summary>
@@ -449,9 +713,9 @@ namespace Harp.VestibularH2
         /// A <see cref="HarpMessage"/> object for the <see cref="NominalPulseInterval"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
         {
-            return HarpMessage.FromUInt16(Address, messageType, value);
+            return HarpMessage.FromUInt32(Address, messageType, value);
         }
 
         /// <summary>
@@ -465,9 +729,9 @@ namespace Harp.VestibularH2
         /// A <see cref="HarpMessage"/> object for the <see cref="NominalPulseInterval"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
         {
-            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
         }
     }
 
@@ -489,16 +753,16 @@ namespace Harp.VestibularH2
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        public static Timestamped<uint> GetPayload(HarpMessage message)
         {
             return NominalPulseInterval.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.
+    /// Represents a register that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.
     /// </summary>
-    [Description("Sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.")]
+    [Description("Sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.")]
     public partial class InitialPulseInterval
     {
         /// <summary>
@@ -509,7 +773,7 @@ namespace Harp.VestibularH2
         /// <summary>
         /// Represents the payload type of the <see cref="InitialPulseInterval"/> register. This field is constant.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U16;
+        public const PayloadType RegisterType = PayloadType.U32;
 
         /// <summary>
         /// Represents the length of the <see cref="InitialPulseInterval"/> register. This field is constant.
@@ -521,9 +785,9 @@ namespace Harp.VestibularH2
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static ushort GetPayload(HarpMessage message)
+        public static uint GetPayload(HarpMessage message)
         {
-            return message.GetPayloadUInt16();
+            return message.GetPayloadUInt32();
         }
 
         /// <summary>
@@ -531,9 +795,9 @@ namespace Harp.VestibularH2
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
         {
-            return message.GetTimestampedPayloadUInt16();
+            return message.GetTimestampedPayloadUInt32();
         }
 
         /// <summary>
@@ -545,9 +809,9 @@ namespace Harp.VestibularH2
         /// A <see cref="HarpMessage"/> object for the <see cref="InitialPulseInterval"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
         {
-            return HarpMessage.FromUInt16(Address, messageType, value);
+            return HarpMessage.FromUInt32(Address, messageType, value);
         }
 
         /// <summary>
@@ -561,9 +825,9 @@ namespace Harp.VestibularH2
         /// A <see cref="HarpMessage"/> object for the <see cref="InitialPulseInterval"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
         {
-            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
         }
     }
 
@@ -585,7 +849,7 @@ namespace Harp.VestibularH2
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        public static Timestamped<uint> GetPayload(HarpMessage message)
         {
             return InitialPulseInterval.GetTimestampedPayload(message);
         }
@@ -1073,9 +1337,9 @@ namespace Harp.VestibularH2
     }
 
     /// <summary>
-    /// Represents a register that contains the state of the motor.
+    /// Represents a register that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.
     /// </summary>
-    [Description("Contains the state of the motor.")]
+    [Description("Contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.")]
     public partial class MotorState
     {
         /// <summary>
@@ -1266,647 +1530,5703 @@ namespace Harp.VestibularH2
     }
 
     /// <summary>
-    /// Represents an operator which creates standard message payloads for the
-    /// VestibularH2 device.
+    /// Represents a register that selects the motion profile used to accelerate and decelerate the motor.
     /// </summary>
-    /// <seealso cref="CreateControlPayload"/>
-    /// <seealso cref="CreatePulsesPayload"/>
-    /// <seealso cref="CreateNominalPulseIntervalPayload"/>
-    /// <seealso cref="CreateInitialPulseIntervalPayload"/>
-    /// <seealso cref="CreatePulseStepIntervalPayload"/>
-    /// <seealso cref="CreatePulsePeriodPayload"/>
-    /// <seealso cref="CreateEncoderPayload"/>
-    /// <seealso cref="CreateAnalogInputPayload"/>
-    /// <seealso cref="CreateStopSwitchPayload"/>
-    /// <seealso cref="CreateMotorStatePayload"/>
-    /// <seealso cref="CreateImmediatePulsesPayload"/>
-    [XmlInclude(typeof(CreateControlPayload))]
-    [XmlInclude(typeof(CreatePulsesPayload))]
-    [XmlInclude(typeof(CreateNominalPulseIntervalPayload))]
-    [XmlInclude(typeof(CreateInitialPulseIntervalPayload))]
-    [XmlInclude(typeof(CreatePulseStepIntervalPayload))]
-    [XmlInclude(typeof(CreatePulsePeriodPayload))]
-    [XmlInclude(typeof(CreateEncoderPayload))]
-    [XmlInclude(typeof(CreateAnalogInputPayload))]
-    [XmlInclude(typeof(CreateStopSwitchPayload))]
-    [XmlInclude(typeof(CreateMotorStatePayload))]
-    [XmlInclude(typeof(CreateImmediatePulsesPayload))]
-    [XmlInclude(typeof(CreateTimestampedControlPayload))]
-    [XmlInclude(typeof(CreateTimestampedPulsesPayload))]
-    [XmlInclude(typeof(CreateTimestampedNominalPulseIntervalPayload))]
-    [XmlInclude(typeof(CreateTimestampedInitialPulseIntervalPayload))]
-    [XmlInclude(typeof(CreateTimestampedPulseStepIntervalPayload))]
-    [XmlInclude(typeof(CreateTimestampedPulsePeriodPayload))]
-    [XmlInclude(typeof(CreateTimestampedEncoderPayload))]
-    [XmlInclude(typeof(CreateTimestampedAnalogInputPayload))]
-    [XmlInclude(typeof(CreateTimestampedStopSwitchPayload))]
-    [XmlInclude(typeof(CreateTimestampedMotorStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedImmediatePulsesPayload))]
-    [Description("Creates standard message payloads for the VestibularH2 device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    [Description("Selects the motion profile used to accelerate and decelerate the motor.")]
+    public partial class ProfileType
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Represents the address of the <see cref="ProfileType"/> register. This field is constant.
         /// </summary>
-        public CreateMessage()
-        {
-            Payload = new CreateControlPayload();
-        }
-
-        string INamedElement.Name => $"{nameof(VestibularH2)}.{GetElementDisplayName(Payload)}";
-    }
+        public const int Address = 43;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that control the device modules.
-    /// </summary>
-    [DisplayName("ControlPayload")]
-    [Description("Creates a message payload that control the device modules.")]
-    public partial class CreateControlPayload
-    {
         /// <summary>
-        /// Gets or sets the value that control the device modules.
+        /// Represents the payload type of the <see cref="ProfileType"/> register. This field is constant.
         /// </summary>
-        [Description("The value that control the device modules.")]
-        public ControlFlags Control { get; set; }
+        public const PayloadType RegisterType = PayloadType.U8;
 
         /// <summary>
-        /// Creates a message payload for the Control register.
+        /// Represents the length of the <see cref="ProfileType"/> register. This field is constant.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ControlFlags GetPayload()
-        {
-            return Control;
-        }
+        public const int RegisterLength = 1;
 
         /// <summary>
-        /// Creates a message that control the device modules.
+        /// Returns the payload data for <see cref="ProfileType"/> register messages.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Control register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static MotionProfile GetPayload(HarpMessage message)
         {
-            return Harp.VestibularH2.Control.FromPayload(messageType, GetPayload());
+            return (MotionProfile)message.GetPayloadByte();
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that control the device modules.
-    /// </summary>
-    [DisplayName("TimestampedControlPayload")]
-    [Description("Creates a timestamped message payload that control the device modules.")]
-    public partial class CreateTimestampedControlPayload : CreateControlPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that control the device modules.
+        /// Returns the timestamped payload data for <see cref="ProfileType"/> register messages.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Control register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<MotionProfile> GetTimestampedPayload(HarpMessage message)
         {
-            return Harp.VestibularH2.Control.FromPayload(timestamp, messageType, GetPayload());
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((MotionProfile)payload.Value, payload.Seconds);
         }
-    }
-
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sends the number of pulses written in this register and set the direction according to the number's sign.
-    /// </summary>
-    [DisplayName("PulsesPayload")]
-    [Description("Creates a message payload that sends the number of pulses written in this register and set the direction according to the number's sign.")]
-    public partial class CreatePulsesPayload
-    {
-        /// <summary>
-        /// Gets or sets the value that sends the number of pulses written in this register and set the direction according to the number's sign.
-        /// </summary>
-        [Description("The value that sends the number of pulses written in this register and set the direction according to the number's sign.")]
-        public int Pulses { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Pulses register.
+        /// Returns a Harp message for the <see cref="ProfileType"/> register.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public int GetPayload()
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfileType"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, MotionProfile value)
         {
-            return Pulses;
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
         }
 
         /// <summary>
-        /// Creates a message that sends the number of pulses written in this register and set the direction according to the number's sign.
+        /// Returns a timestamped Harp message for the <see cref="ProfileType"/>
+        /// register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Pulses register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfileType"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, MotionProfile value)
         {
-            return Harp.VestibularH2.Pulses.FromPayload(messageType, GetPayload());
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that sends the number of pulses written in this register and set the direction according to the number's sign.
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfileType register.
     /// </summary>
-    [DisplayName("TimestampedPulsesPayload")]
-    [Description("Creates a timestamped message payload that sends the number of pulses written in this register and set the direction according to the number's sign.")]
-    public partial class CreateTimestampedPulsesPayload : CreatePulsesPayload
+    /// <seealso cref="ProfileType"/>
+    [Description("Filters and selects timestamped messages from the ProfileType register.")]
+    public partial class TimestampedProfileType
     {
         /// <summary>
-        /// Creates a timestamped message that sends the number of pulses written in this register and set the direction according to the number's sign.
+        /// Represents the address of the <see cref="ProfileType"/> register. This field is constant.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Pulses register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        public const int Address = ProfileType.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfileType"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<MotionProfile> GetPayload(HarpMessage message)
         {
-            return Harp.VestibularH2.Pulses.FromPayload(timestamp, messageType, GetPayload());
+            return ProfileType.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sets the motor pulse interval when running at nominal speed.
+    /// Represents a register that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.
     /// </summary>
-    [DisplayName("NominalPulseIntervalPayload")]
-    [Description("Creates a message payload that sets the motor pulse interval when running at nominal speed.")]
-    public partial class CreateNominalPulseIntervalPayload
+    [Description("Sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.")]
+    public partial class Acceleration
     {
         /// <summary>
-        /// Gets or sets the value that sets the motor pulse interval when running at nominal speed.
+        /// Represents the address of the <see cref="Acceleration"/> register. This field is constant.
         /// </summary>
-        [Description("The value that sets the motor pulse interval when running at nominal speed.")]
-        public ushort NominalPulseInterval { get; set; }
+        public const int Address = 44;
 
         /// <summary>
-        /// Creates a message payload for the NominalPulseInterval register.
+        /// Represents the payload type of the <see cref="Acceleration"/> register. This field is constant.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return NominalPulseInterval;
-        }
+        public const PayloadType RegisterType = PayloadType.U32;
 
         /// <summary>
-        /// Creates a message that sets the motor pulse interval when running at nominal speed.
+        /// Represents the length of the <see cref="Acceleration"/> register. This field is constant.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the NominalPulseInterval register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.VestibularH2.NominalPulseInterval.FromPayload(messageType, GetPayload());
-        }
-    }
+        public const int RegisterLength = 1;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that sets the motor pulse interval when running at nominal speed.
-    /// </summary>
-    [DisplayName("TimestampedNominalPulseIntervalPayload")]
-    [Description("Creates a timestamped message payload that sets the motor pulse interval when running at nominal speed.")]
-    public partial class CreateTimestampedNominalPulseIntervalPayload : CreateNominalPulseIntervalPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that sets the motor pulse interval when running at nominal speed.
+        /// Returns the payload data for <see cref="Acceleration"/> register messages.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the NominalPulseInterval register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
         {
-            return Harp.VestibularH2.NominalPulseInterval.FromPayload(timestamp, messageType, GetPayload());
+            return message.GetPayloadUInt32();
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.
-    /// </summary>
-    [DisplayName("InitialPulseIntervalPayload")]
-    [Description("Creates a message payload that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.")]
-    public partial class CreateInitialPulseIntervalPayload
-    {
         /// <summary>
-        /// Gets or sets the value that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.
+        /// Returns the timestamped payload data for <see cref="Acceleration"/> register messages.
         /// </summary>
-        [Description("The value that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.")]
-        public ushort InitialPulseInterval { get; set; }
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
 
         /// <summary>
-        /// Creates a message payload for the InitialPulseInterval register.
+        /// Returns a Harp message for the <see cref="Acceleration"/> register.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Acceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
         {
-            return InitialPulseInterval;
+            return HarpMessage.FromUInt32(Address, messageType, value);
         }
 
         /// <summary>
-        /// Creates a message that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.
+        /// Returns a timestamped Harp message for the <see cref="Acceleration"/>
+        /// register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the InitialPulseInterval register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Acceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
         {
-            return Harp.VestibularH2.InitialPulseInterval.FromPayload(messageType, GetPayload());
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.
+    /// Provides methods for manipulating timestamped messages from the
+    /// Acceleration register.
     /// </summary>
-    [DisplayName("TimestampedInitialPulseIntervalPayload")]
-    [Description("Creates a timestamped message payload that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.")]
-    public partial class CreateTimestampedInitialPulseIntervalPayload : CreateInitialPulseIntervalPayload
+    /// <seealso cref="Acceleration"/>
+    [Description("Filters and selects timestamped messages from the Acceleration register.")]
+    public partial class TimestampedAcceleration
     {
         /// <summary>
-        /// Creates a timestamped message that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation.
+        /// Represents the address of the <see cref="Acceleration"/> register. This field is constant.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the InitialPulseInterval register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        public const int Address = Acceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Acceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
         {
-            return Harp.VestibularH2.InitialPulseInterval.FromPayload(timestamp, messageType, GetPayload());
+            return Acceleration.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+    /// Represents a register that sets the maximum jerk of the S-curve profile, in steps per second cubed.
     /// </summary>
-    [DisplayName("PulseStepIntervalPayload")]
-    [Description("Creates a message payload that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.")]
-    public partial class CreatePulseStepIntervalPayload
+    [Description("Sets the maximum jerk of the S-curve profile, in steps per second cubed.")]
+    public partial class Jerk
     {
         /// <summary>
-        /// Gets or sets the value that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+        /// Represents the address of the <see cref="Jerk"/> register. This field is constant.
         /// </summary>
-        [Description("The value that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.")]
-        public ushort PulseStepInterval { get; set; }
+        public const int Address = 45;
 
         /// <summary>
-        /// Creates a message payload for the PulseStepInterval register.
+        /// Represents the payload type of the <see cref="Jerk"/> register. This field is constant.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return PulseStepInterval;
-        }
+        public const PayloadType RegisterType = PayloadType.U32;
 
         /// <summary>
-        /// Creates a message that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+        /// Represents the length of the <see cref="Jerk"/> register. This field is constant.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PulseStepInterval register.</returns>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Jerk"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Jerk"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Jerk"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Jerk"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Jerk"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Jerk"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Jerk register.
+    /// </summary>
+    /// <seealso cref="Jerk"/>
+    [Description("Filters and selects timestamped messages from the Jerk register.")]
+    public partial class TimestampedJerk
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Jerk"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Jerk.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Jerk"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Jerk.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.
+    /// </summary>
+    [Description("Enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.")]
+    public partial class Segments
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Segments"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 46;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Segments"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Segments"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Segments"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<int>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Segments"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<int>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Segments"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Segments"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int[] value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Segments"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Segments"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int[] value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Segments register.
+    /// </summary>
+    /// <seealso cref="Segments"/>
+    [Description("Filters and selects timestamped messages from the Segments register.")]
+    public partial class TimestampedSegments
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Segments"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Segments.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Segments"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int[]> GetPayload(HarpMessage message)
+        {
+            return Segments.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the number of free entries in the motion segments queue.
+    /// </summary>
+    [Description("Contains the number of free entries in the motion segments queue.")]
+    public partial class SegmentQueueSpace
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SegmentQueueSpace"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 47;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SegmentQueueSpace"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SegmentQueueSpace"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SegmentQueueSpace"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SegmentQueueSpace"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SegmentQueueSpace"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SegmentQueueSpace"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SegmentQueueSpace"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SegmentQueueSpace"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SegmentQueueSpace register.
+    /// </summary>
+    /// <seealso cref="SegmentQueueSpace"/>
+    [Description("Filters and selects timestamped messages from the SegmentQueueSpace register.")]
+    public partial class TimestampedSegmentQueueSpace
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SegmentQueueSpace"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SegmentQueueSpace.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SegmentQueueSpace"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SegmentQueueSpace.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.
+    /// </summary>
+    [Description("Contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.")]
+    public partial class Position
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Position"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 48;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Position"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Position"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Position"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Position"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Position"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Position"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Position"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Position"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Position register.
+    /// </summary>
+    /// <seealso cref="Position"/>
+    [Description("Filters and selects timestamped messages from the Position register.")]
+    public partial class TimestampedPosition
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Position"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Position.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Position"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return Position.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that moves the motor to the absolute position written in this register, in pulses.
+    /// </summary>
+    [Description("Moves the motor to the absolute position written in this register, in pulses.")]
+    public partial class MoveTo
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MoveTo"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 49;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MoveTo"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MoveTo"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MoveTo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MoveTo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MoveTo"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MoveTo"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MoveTo"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MoveTo"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MoveTo register.
+    /// </summary>
+    /// <seealso cref="MoveTo"/>
+    [Description("Filters and selects timestamped messages from the MoveTo register.")]
+    public partial class TimestampedMoveTo
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MoveTo"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MoveTo.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MoveTo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return MoveTo.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.
+    /// </summary>
+    [Description("Sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.")]
+    public partial class Velocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Velocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 50;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Velocity"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Velocity"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Velocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static short GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Velocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Velocity"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Velocity"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, short value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Velocity"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Velocity"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Velocity register.
+    /// </summary>
+    /// <seealso cref="Velocity"/>
+    [Description("Filters and selects timestamped messages from the Velocity register.")]
+    public partial class TimestampedVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Velocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Velocity.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Velocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short> GetPayload(HarpMessage message)
+        {
+            return Velocity.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables the closed loop correction of the motor position using the quadrature encoder.
+    /// </summary>
+    [Description("Enables the closed loop correction of the motor position using the quadrature encoder.")]
+    public partial class ClosedLoop
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ClosedLoop"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 51;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ClosedLoop"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ClosedLoop"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ClosedLoop"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ClosedLoopFlags GetPayload(HarpMessage message)
+        {
+            return (ClosedLoopFlags)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ClosedLoop"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ClosedLoopFlags> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ClosedLoopFlags)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ClosedLoop"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ClosedLoop"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ClosedLoopFlags value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ClosedLoop"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ClosedLoop"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ClosedLoopFlags value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ClosedLoop register.
+    /// </summary>
+    /// <seealso cref="ClosedLoop"/>
+    [Description("Filters and selects timestamped messages from the ClosedLoop register.")]
+    public partial class TimestampedClosedLoop
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ClosedLoop"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ClosedLoop.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ClosedLoop"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ClosedLoopFlags> GetPayload(HarpMessage message)
+        {
+            return ClosedLoop.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.
+    /// </summary>
+    [Description("Sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.")]
+    public partial class StepsPerCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepsPerCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 52;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StepsPerCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StepsPerCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StepsPerCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static short GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StepsPerCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StepsPerCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepsPerCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, short value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StepsPerCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepsPerCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StepsPerCount register.
+    /// </summary>
+    /// <seealso cref="StepsPerCount"/>
+    [Description("Filters and selects timestamped messages from the StepsPerCount register.")]
+    public partial class TimestampedStepsPerCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepsPerCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StepsPerCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StepsPerCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short> GetPayload(HarpMessage message)
+        {
+            return StepsPerCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.
+    /// </summary>
+    [Description("Sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.")]
+    public partial class ClosedLoopGains
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ClosedLoopGains"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 53;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ClosedLoopGains"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ClosedLoopGains"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ClosedLoopGains"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ClosedLoopGains"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ClosedLoopGains"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ClosedLoopGains"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ClosedLoopGains"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ClosedLoopGains"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ClosedLoopGains register.
+    /// </summary>
+    /// <seealso cref="ClosedLoopGains"/>
+    [Description("Filters and selects timestamped messages from the ClosedLoopGains register.")]
+    public partial class TimestampedClosedLoopGains
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ClosedLoopGains"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ClosedLoopGains.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ClosedLoopGains"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ClosedLoopGains.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the number of pulses missed by the motor and not yet corrected by the closed loop.
+    /// </summary>
+    [Description("Contains the number of pulses missed by the motor and not yet corrected by the closed loop.")]
+    public partial class PositionError
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PositionError"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 54;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PositionError"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PositionError"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PositionError"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PositionError"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PositionError"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PositionError"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PositionError"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PositionError"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PositionError register.
+    /// </summary>
+    /// <seealso cref="PositionError"/>
+    [Description("Filters and selects timestamped messages from the PositionError register.")]
+    public partial class TimestampedPositionError
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PositionError"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PositionError.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PositionError"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return PositionError.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of samples of the velocity waveform and restarts its upload.
+    /// </summary>
+    [Description("Sets the number of samples of the velocity waveform and restarts its upload.")]
+    public partial class WaveformLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WaveformLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 55;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="WaveformLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="WaveformLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="WaveformLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="WaveformLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="WaveformLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WaveformLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="WaveformLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WaveformLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// WaveformLength register.
+    /// </summary>
+    /// <seealso cref="WaveformLength"/>
+    [Description("Filters and selects timestamped messages from the WaveformLength register.")]
+    public partial class TimestampedWaveformLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WaveformLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = WaveformLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="WaveformLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return WaveformLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.
+    /// </summary>
+    [Description("Appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.")]
+    public partial class WaveformSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WaveformSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 56;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="WaveformSamples"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="WaveformSamples"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="WaveformSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static short[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<short>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="WaveformSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<short>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="WaveformSamples"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WaveformSamples"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, short[] value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="WaveformSamples"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WaveformSamples"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short[] value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// WaveformSamples register.
+    /// </summary>
+    /// <seealso cref="WaveformSamples"/>
+    [Description("Filters and selects timestamped messages from the WaveformSamples register.")]
+    public partial class TimestampedWaveformSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WaveformSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = WaveformSamples.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="WaveformSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short[]> GetPayload(HarpMessage message)
+        {
+            return WaveformSamples.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the interval between the waveform samples, in microseconds.
+    /// </summary>
+    [Description("Sets the interval between the waveform samples, in microseconds.")]
+    public partial class WaveformSampleInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WaveformSampleInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 57;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="WaveformSampleInterval"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="WaveformSampleInterval"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="WaveformSampleInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="WaveformSampleInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="WaveformSampleInterval"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WaveformSampleInterval"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="WaveformSampleInterval"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WaveformSampleInterval"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// WaveformSampleInterval register.
+    /// </summary>
+    /// <seealso cref="WaveformSampleInterval"/>
+    [Description("Filters and selects timestamped messages from the WaveformSampleInterval register.")]
+    public partial class TimestampedWaveformSampleInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WaveformSampleInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = WaveformSampleInterval.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="WaveformSampleInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return WaveformSampleInterval.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts and stops the waveform playback. An event is sent when the playback ends.
+    /// </summary>
+    [Description("Starts and stops the waveform playback. An event is sent when the playback ends.")]
+    public partial class WaveformControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WaveformControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 58;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="WaveformControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="WaveformControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="WaveformControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static WaveformControlFlags GetPayload(HarpMessage message)
+        {
+            return (WaveformControlFlags)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="WaveformControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<WaveformControlFlags> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((WaveformControlFlags)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="WaveformControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WaveformControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, WaveformControlFlags value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="WaveformControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WaveformControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, WaveformControlFlags value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// WaveformControl register.
+    /// </summary>
+    /// <seealso cref="WaveformControl"/>
+    [Description("Filters and selects timestamped messages from the WaveformControl register.")]
+    public partial class TimestampedWaveformControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WaveformControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = WaveformControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="WaveformControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<WaveformControlFlags> GetPayload(HarpMessage message)
+        {
+            return WaveformControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the peak velocity of the sinusoidal oscillation, in pulses per second.
+    /// </summary>
+    [Description("Sets the peak velocity of the sinusoidal oscillation, in pulses per second.")]
+    public partial class OscillationAmplitude
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OscillationAmplitude"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 59;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OscillationAmplitude"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OscillationAmplitude"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OscillationAmplitude"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OscillationAmplitude"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OscillationAmplitude"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OscillationAmplitude"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OscillationAmplitude"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OscillationAmplitude"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OscillationAmplitude register.
+    /// </summary>
+    /// <seealso cref="OscillationAmplitude"/>
+    [Description("Filters and selects timestamped messages from the OscillationAmplitude register.")]
+    public partial class TimestampedOscillationAmplitude
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OscillationAmplitude"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OscillationAmplitude.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OscillationAmplitude"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return OscillationAmplitude.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the frequency of the sinusoidal oscillation, in millihertz.
+    /// </summary>
+    [Description("Sets the frequency of the sinusoidal oscillation, in millihertz.")]
+    public partial class OscillationFrequency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OscillationFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OscillationFrequency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OscillationFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OscillationFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OscillationFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OscillationFrequency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OscillationFrequency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OscillationFrequency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OscillationFrequency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OscillationFrequency register.
+    /// </summary>
+    /// <seealso cref="OscillationFrequency"/>
+    [Description("Filters and selects timestamped messages from the OscillationFrequency register.")]
+    public partial class TimestampedOscillationFrequency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OscillationFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OscillationFrequency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OscillationFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return OscillationFrequency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.
+    /// </summary>
+    [Description("Sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.")]
+    public partial class OscillationPhase
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OscillationPhase"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OscillationPhase"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OscillationPhase"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OscillationPhase"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OscillationPhase"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OscillationPhase"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OscillationPhase"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OscillationPhase"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OscillationPhase"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OscillationPhase register.
+    /// </summary>
+    /// <seealso cref="OscillationPhase"/>
+    [Description("Filters and selects timestamped messages from the OscillationPhase register.")]
+    public partial class TimestampedOscillationPhase
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OscillationPhase"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OscillationPhase.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OscillationPhase"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return OscillationPhase.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.
+    /// </summary>
+    [Description("Sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.")]
+    public partial class OscillationCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OscillationCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OscillationCycles"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OscillationCycles"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OscillationCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OscillationCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OscillationCycles"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OscillationCycles"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OscillationCycles"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OscillationCycles"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OscillationCycles register.
+    /// </summary>
+    /// <seealso cref="OscillationCycles"/>
+    [Description("Filters and selects timestamped messages from the OscillationCycles register.")]
+    public partial class TimestampedOscillationCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OscillationCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OscillationCycles.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OscillationCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return OscillationCycles.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects how the pulses of the velocity, waveform and oscillation modes are generated.
+    /// </summary>
+    [Description("Selects how the pulses of the velocity, waveform and oscillation modes are generated.")]
+    public partial class StepGenerator
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepGenerator"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StepGenerator"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StepGenerator"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StepGenerator"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StepGeneratorType GetPayload(HarpMessage message)
+        {
+            return (StepGeneratorType)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StepGenerator"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StepGeneratorType> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((StepGeneratorType)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StepGenerator"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepGenerator"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StepGeneratorType value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StepGenerator"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepGenerator"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StepGeneratorType value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StepGenerator register.
+    /// </summary>
+    /// <seealso cref="StepGenerator"/>
+    [Description("Filters and selects timestamped messages from the StepGenerator register.")]
+    public partial class TimestampedStepGenerator
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepGenerator"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StepGenerator.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StepGenerator"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StepGeneratorType> GetPayload(HarpMessage message)
+        {
+            return StepGenerator.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables counting the pulses of the cruise phase in hardware, without step interrupts.
+    /// </summary>
+    [Description("Enables counting the pulses of the cruise phase in hardware, without step interrupts.")]
+    public partial class HardwareCruise
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HardwareCruise"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="HardwareCruise"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="HardwareCruise"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="HardwareCruise"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static HardwareCruiseFlags GetPayload(HarpMessage message)
+        {
+            return (HardwareCruiseFlags)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="HardwareCruise"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<HardwareCruiseFlags> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((HardwareCruiseFlags)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="HardwareCruise"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HardwareCruise"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, HardwareCruiseFlags value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="HardwareCruise"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HardwareCruise"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, HardwareCruiseFlags value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// HardwareCruise register.
+    /// </summary>
+    /// <seealso cref="HardwareCruise"/>
+    [Description("Filters and selects timestamped messages from the HardwareCruise register.")]
+    public partial class TimestampedHardwareCruise
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HardwareCruise"/> register. This field is constant.
+        /// </summary>
+        public const int Address = HardwareCruise.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="HardwareCruise"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<HardwareCruiseFlags> GetPayload(HarpMessage message)
+        {
+            return HardwareCruise.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.
+    /// </summary>
+    [Description("Contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.")]
+    public partial class IsrStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IsrStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IsrStatistics"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IsrStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 21;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IsrStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IsrStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IsrStatistics"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IsrStatistics"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IsrStatistics"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IsrStatistics"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IsrStatistics register.
+    /// </summary>
+    /// <seealso cref="IsrStatistics"/>
+    [Description("Filters and selects timestamped messages from the IsrStatistics register.")]
+    public partial class TimestampedIsrStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IsrStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IsrStatistics.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IsrStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return IsrStatistics.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables the trace of the step periods of the ramped moves. Enabling clears the trace.
+    /// </summary>
+    [Description("Enables the trace of the step periods of the ramped moves. Enabling clears the trace.")]
+    public partial class TraceControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TraceControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TraceControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TraceControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TraceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TraceControlFlags GetPayload(HarpMessage message)
+        {
+            return (TraceControlFlags)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TraceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TraceControlFlags> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TraceControlFlags)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TraceControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TraceControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TraceControlFlags value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TraceControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TraceControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TraceControlFlags value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TraceControl register.
+    /// </summary>
+    /// <seealso cref="TraceControl"/>
+    [Description("Filters and selects timestamped messages from the TraceControl register.")]
+    public partial class TimestampedTraceControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TraceControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TraceControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TraceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TraceControlFlags> GetPayload(HarpMessage message)
+        {
+            return TraceControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the number of steps traced. Only the last 256 steps are kept.
+    /// </summary>
+    [Description("Contains the number of steps traced. Only the last 256 steps are kept.")]
+    public partial class TraceSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TraceSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TraceSteps"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TraceSteps"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TraceSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TraceSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TraceSteps"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TraceSteps"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TraceSteps"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TraceSteps"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TraceSteps register.
+    /// </summary>
+    /// <seealso cref="TraceSteps"/>
+    [Description("Filters and selects timestamped messages from the TraceSteps register.")]
+    public partial class TimestampedTraceSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TraceSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TraceSteps.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TraceSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return TraceSteps.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the first step read from TraceData, counted from the oldest step kept.
+    /// </summary>
+    [Description("Sets the first step read from TraceData, counted from the oldest step kept.")]
+    public partial class TraceIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TraceIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TraceIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TraceIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TraceIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TraceIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TraceIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TraceIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TraceIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TraceIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TraceIndex register.
+    /// </summary>
+    /// <seealso cref="TraceIndex"/>
+    [Description("Filters and selects timestamped messages from the TraceIndex register.")]
+    public partial class TimestampedTraceIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TraceIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TraceIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TraceIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return TraceIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.
+    /// </summary>
+    [Description("Contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.")]
+    public partial class TraceData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TraceData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TraceData"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TraceData"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TraceData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TraceData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TraceData"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TraceData"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TraceData"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TraceData"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TraceData register.
+    /// </summary>
+    /// <seealso cref="TraceData"/>
+    [Description("Filters and selects timestamped messages from the TraceData register.")]
+    public partial class TimestampedTraceData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TraceData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TraceData.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TraceData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return TraceData.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.
+    /// </summary>
+    [Description("Starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.")]
+    public partial class ScheduledStart
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduledStart"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ScheduledStart"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ScheduledStart"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ScheduledStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ScheduledStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ScheduledStart"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduledStart"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ScheduledStart"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduledStart"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ScheduledStart register.
+    /// </summary>
+    /// <seealso cref="ScheduledStart"/>
+    [Description("Filters and selects timestamped messages from the ScheduledStart register.")]
+    public partial class TimestampedScheduledStart
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduledStart"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ScheduledStart.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ScheduledStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return ScheduledStart.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.
+    /// </summary>
+    [Description("Sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.")]
+    public partial class MotionCommand
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MotionCommand"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MotionCommand"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MotionCommand"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MotionCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<int>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MotionCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<int>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MotionCommand"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MotionCommand"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int[] value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MotionCommand"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MotionCommand"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int[] value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MotionCommand register.
+    /// </summary>
+    /// <seealso cref="MotionCommand"/>
+    [Description("Filters and selects timestamped messages from the MotionCommand register.")]
+    public partial class TimestampedMotionCommand
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MotionCommand"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MotionCommand.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MotionCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int[]> GetPayload(HarpMessage message)
+        {
+            return MotionCommand.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.
+    /// </summary>
+    [Description("Selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.")]
+    public partial class ExternalControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExternalControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ExternalControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ExternalControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ExternalControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ExternalControlProtocol GetPayload(HarpMessage message)
+        {
+            return (ExternalControlProtocol)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ExternalControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ExternalControlProtocol> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ExternalControlProtocol)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ExternalControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExternalControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ExternalControlProtocol value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ExternalControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExternalControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ExternalControlProtocol value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ExternalControl register.
+    /// </summary>
+    /// <seealso cref="ExternalControl"/>
+    [Description("Filters and selects timestamped messages from the ExternalControl register.")]
+    public partial class TimestampedExternalControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExternalControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ExternalControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ExternalControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ExternalControlProtocol> GetPayload(HarpMessage message)
+        {
+            return ExternalControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.
+    /// </summary>
+    [Description("Sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.")]
+    public partial class ExternalBaudRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExternalBaudRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ExternalBaudRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ExternalBaudRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ExternalBaudRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ExternalBaudRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ExternalBaudRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExternalBaudRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ExternalBaudRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExternalBaudRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ExternalBaudRate register.
+    /// </summary>
+    /// <seealso cref="ExternalBaudRate"/>
+    [Description("Filters and selects timestamped messages from the ExternalBaudRate register.")]
+    public partial class TimestampedExternalBaudRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExternalBaudRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ExternalBaudRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ExternalBaudRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return ExternalBaudRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.
+    /// </summary>
+    [Description("Contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.")]
+    public partial class ExternalStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExternalStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ExternalStatistics"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ExternalStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ExternalStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ExternalStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ExternalStatistics"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExternalStatistics"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ExternalStatistics"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExternalStatistics"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ExternalStatistics register.
+    /// </summary>
+    /// <seealso cref="ExternalStatistics"/>
+    [Description("Filters and selects timestamped messages from the ExternalStatistics register.")]
+    public partial class TimestampedExternalStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExternalStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ExternalStatistics.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ExternalStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ExternalStatistics.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.
+    /// </summary>
+    [Description("Contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.")]
+    public partial class EncoderVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EncoderVelocity"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EncoderVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EncoderVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EncoderVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EncoderVelocity"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderVelocity"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EncoderVelocity"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderVelocity"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EncoderVelocity register.
+    /// </summary>
+    /// <seealso cref="EncoderVelocity"/>
+    [Description("Filters and selects timestamped messages from the EncoderVelocity register.")]
+    public partial class TimestampedEncoderVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EncoderVelocity.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EncoderVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return EncoderVelocity.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator which creates standard message payloads for the
+    /// VestibularH2 device.
+    /// </summary>
+    /// <seealso cref="CreateControlPayload"/>
+    /// <seealso cref="CreatePulsesPayload"/>
+    /// <seealso cref="CreateNominalPulseIntervalPayload"/>
+    /// <seealso cref="CreateInitialPulseIntervalPayload"/>
+    /// <seealso cref="CreatePulseStepIntervalPayload"/>
+    /// <seealso cref="CreatePulsePeriodPayload"/>
+    /// <seealso cref="CreateEncoderPayload"/>
+    /// <seealso cref="CreateAnalogInputPayload"/>
+    /// <seealso cref="CreateStopSwitchPayload"/>
+    /// <seealso cref="CreateMotorStatePayload"/>
+    /// <seealso cref="CreateImmediatePulsesPayload"/>
+    /// <seealso cref="CreateProfileTypePayload"/>
+    /// <seealso cref="CreateAccelerationPayload"/>
+    /// <seealso cref="CreateJerkPayload"/>
+    /// <seealso cref="CreateSegmentsPayload"/>
+    /// <seealso cref="CreateSegmentQueueSpacePayload"/>
+    /// <seealso cref="CreatePositionPayload"/>
+    /// <seealso cref="CreateMoveToPayload"/>
+    /// <seealso cref="CreateVelocityPayload"/>
+    /// <seealso cref="CreateClosedLoopPayload"/>
+    /// <seealso cref="CreateStepsPerCountPayload"/>
+    /// <seealso cref="CreateClosedLoopGainsPayload"/>
+    /// <seealso cref="CreatePositionErrorPayload"/>
+    /// <seealso cref="CreateWaveformLengthPayload"/>
+    /// <seealso cref="CreateWaveformSamplesPayload"/>
+    /// <seealso cref="CreateWaveformSampleIntervalPayload"/>
+    /// <seealso cref="CreateWaveformControlPayload"/>
+    /// <seealso cref="CreateOscillationAmplitudePayload"/>
+    /// <seealso cref="CreateOscillationFrequencyPayload"/>
+    /// <seealso cref="CreateOscillationPhasePayload"/>
+    /// <seealso cref="CreateOscillationCyclesPayload"/>
+    /// <seealso cref="CreateStepGeneratorPayload"/>
+    /// <seealso cref="CreateHardwareCruisePayload"/>
+    /// <seealso cref="CreateIsrStatisticsPayload"/>
+    /// <seealso cref="CreateTraceControlPayload"/>
+    /// <seealso cref="CreateTraceStepsPayload"/>
+    /// <seealso cref="CreateTraceIndexPayload"/>
+    /// <seealso cref="CreateTraceDataPayload"/>
+    /// <seealso cref="CreateScheduledStartPayload"/>
+    /// <seealso cref="CreateMotionCommandPayload"/>
+    /// <seealso cref="CreateExternalControlPayload"/>
+    /// <seealso cref="CreateExternalBaudRatePayload"/>
+    /// <seealso cref="CreateExternalStatisticsPayload"/>
+    /// <seealso cref="CreateEncoderVelocityPayload"/>
+    [XmlInclude(typeof(CreateControlPayload))]
+    [XmlInclude(typeof(CreatePulsesPayload))]
+    [XmlInclude(typeof(CreateNominalPulseIntervalPayload))]
+    [XmlInclude(typeof(CreateInitialPulseIntervalPayload))]
+    [XmlInclude(typeof(CreatePulseStepIntervalPayload))]
+    [XmlInclude(typeof(CreatePulsePeriodPayload))]
+    [XmlInclude(typeof(CreateEncoderPayload))]
+    [XmlInclude(typeof(CreateAnalogInputPayload))]
+    [XmlInclude(typeof(CreateStopSwitchPayload))]
+    [XmlInclude(typeof(CreateMotorStatePayload))]
+    [XmlInclude(typeof(CreateImmediatePulsesPayload))]
+    [XmlInclude(typeof(CreateProfileTypePayload))]
+    [XmlInclude(typeof(CreateAccelerationPayload))]
+    [XmlInclude(typeof(CreateJerkPayload))]
+    [XmlInclude(typeof(CreateSegmentsPayload))]
+    [XmlInclude(typeof(CreateSegmentQueueSpacePayload))]
+    [XmlInclude(typeof(CreatePositionPayload))]
+    [XmlInclude(typeof(CreateMoveToPayload))]
+    [XmlInclude(typeof(CreateVelocityPayload))]
+    [XmlInclude(typeof(CreateClosedLoopPayload))]
+    [XmlInclude(typeof(CreateStepsPerCountPayload))]
+    [XmlInclude(typeof(CreateClosedLoopGainsPayload))]
+    [XmlInclude(typeof(CreatePositionErrorPayload))]
+    [XmlInclude(typeof(CreateWaveformLengthPayload))]
+    [XmlInclude(typeof(CreateWaveformSamplesPayload))]
+    [XmlInclude(typeof(CreateWaveformSampleIntervalPayload))]
+    [XmlInclude(typeof(CreateWaveformControlPayload))]
+    [XmlInclude(typeof(CreateOscillationAmplitudePayload))]
+    [XmlInclude(typeof(CreateOscillationFrequencyPayload))]
+    [XmlInclude(typeof(CreateOscillationPhasePayload))]
+    [XmlInclude(typeof(CreateOscillationCyclesPayload))]
+    [XmlInclude(typeof(CreateStepGeneratorPayload))]
+    [XmlInclude(typeof(CreateHardwareCruisePayload))]
+    [XmlInclude(typeof(CreateIsrStatisticsPayload))]
+    [XmlInclude(typeof(CreateTraceControlPayload))]
+    [XmlInclude(typeof(CreateTraceStepsPayload))]
+    [XmlInclude(typeof(CreateTraceIndexPayload))]
+    [XmlInclude(typeof(CreateTraceDataPayload))]
+    [XmlInclude(typeof(CreateScheduledStartPayload))]
+    [XmlInclude(typeof(CreateMotionCommandPayload))]
+    [XmlInclude(typeof(CreateExternalControlPayload))]
+    [XmlInclude(typeof(CreateExternalBaudRatePayload))]
+    [XmlInclude(typeof(CreateExternalStatisticsPayload))]
+    [XmlInclude(typeof(CreateEncoderVelocityPayload))]
+    [XmlInclude(typeof(CreateTimestampedControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulsesPayload))]
+    [XmlInclude(typeof(CreateTimestampedNominalPulseIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedInitialPulseIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseStepIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulsePeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedEncoderPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogInputPayload))]
+    [XmlInclude(typeof(CreateTimestampedStopSwitchPayload))]
+    [XmlInclude(typeof(CreateTimestampedMotorStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedImmediatePulsesPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfileTypePayload))]
+    [XmlInclude(typeof(CreateTimestampedAccelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedJerkPayload))]
+    [XmlInclude(typeof(CreateTimestampedSegmentsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSegmentQueueSpacePayload))]
+    [XmlInclude(typeof(CreateTimestampedPositionPayload))]
+    [XmlInclude(typeof(CreateTimestampedMoveToPayload))]
+    [XmlInclude(typeof(CreateTimestampedVelocityPayload))]
+    [XmlInclude(typeof(CreateTimestampedClosedLoopPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepsPerCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedClosedLoopGainsPayload))]
+    [XmlInclude(typeof(CreateTimestampedPositionErrorPayload))]
+    [XmlInclude(typeof(CreateTimestampedWaveformLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedWaveformSamplesPayload))]
+    [XmlInclude(typeof(CreateTimestampedWaveformSampleIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedWaveformControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedOscillationAmplitudePayload))]
+    [XmlInclude(typeof(CreateTimestampedOscillationFrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedOscillationPhasePayload))]
+    [XmlInclude(typeof(CreateTimestampedOscillationCyclesPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepGeneratorPayload))]
+    [XmlInclude(typeof(CreateTimestampedHardwareCruisePayload))]
+    [XmlInclude(typeof(CreateTimestampedIsrStatisticsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTraceControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedTraceStepsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTraceIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedTraceDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedScheduledStartPayload))]
+    [XmlInclude(typeof(CreateTimestampedMotionCommandPayload))]
+    [XmlInclude(typeof(CreateTimestampedExternalControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedExternalBaudRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedExternalStatisticsPayload))]
+    [XmlInclude(typeof(CreateTimestampedEncoderVelocityPayload))]
+    [Description("Creates standard message payloads for the VestibularH2 device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateControlPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(VestibularH2)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that control the device modules.
+    /// </summary>
+    [DisplayName("ControlPayload")]
+    [Description("Creates a message payload that control the device modules.")]
+    public partial class CreateControlPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that control the device modules.
+        /// </summary>
+        [Description("The value that control the device modules.")]
+        public ControlFlags Control { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Control register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ControlFlags GetPayload()
+        {
+            return Control;
+        }
+
+        /// <summary>
+        /// Creates a message that control the device modules.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Control register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.Control.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that control the device modules.
+    /// </summary>
+    [DisplayName("TimestampedControlPayload")]
+    [Description("Creates a timestamped message payload that control the device modules.")]
+    public partial class CreateTimestampedControlPayload : CreateControlPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that control the device modules.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Control register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.Control.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sends the number of pulses written in this register and set the direction according to the number's sign.
+    /// </summary>
+    [DisplayName("PulsesPayload")]
+    [Description("Creates a message payload that sends the number of pulses written in this register and set the direction according to the number's sign.")]
+    public partial class CreatePulsesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sends the number of pulses written in this register and set the direction according to the number's sign.
+        /// </summary>
+        [Description("The value that sends the number of pulses written in this register and set the direction according to the number's sign.")]
+        public int Pulses { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Pulses register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return Pulses;
+        }
+
+        /// <summary>
+        /// Creates a message that sends the number of pulses written in this register and set the direction according to the number's sign.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Pulses register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.Pulses.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sends the number of pulses written in this register and set the direction according to the number's sign.
+    /// </summary>
+    [DisplayName("TimestampedPulsesPayload")]
+    [Description("Creates a timestamped message payload that sends the number of pulses written in this register and set the direction according to the number's sign.")]
+    public partial class CreateTimestampedPulsesPayload : CreatePulsesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sends the number of pulses written in this register and set the direction according to the number's sign.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Pulses register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.Pulses.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.
+    /// </summary>
+    [DisplayName("NominalPulseIntervalPayload")]
+    [Description("Creates a message payload that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.")]
+    public partial class CreateNominalPulseIntervalPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.
+        /// </summary>
+        [Description("The value that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.")]
+        public uint NominalPulseInterval { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the NominalPulseInterval register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return NominalPulseInterval;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the NominalPulseInterval register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.NominalPulseInterval.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.
+    /// </summary>
+    [DisplayName("TimestampedNominalPulseIntervalPayload")]
+    [Description("Creates a timestamped message payload that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.")]
+    public partial class CreateTimestampedNominalPulseIntervalPayload : CreateNominalPulseIntervalPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the motor pulse interval when running at nominal speed. The ramp registers can also be written during a ramped move, the new ramp applies from the next pulse starting at the current speed.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the NominalPulseInterval register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.NominalPulseInterval.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.
+    /// </summary>
+    [DisplayName("InitialPulseIntervalPayload")]
+    [Description("Creates a message payload that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.")]
+    public partial class CreateInitialPulseIntervalPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.
+        /// </summary>
+        [Description("The value that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.")]
+        public uint InitialPulseInterval { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the InitialPulseInterval register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return InitialPulseInterval;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the InitialPulseInterval register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.InitialPulseInterval.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.
+    /// </summary>
+    [DisplayName("TimestampedInitialPulseIntervalPayload")]
+    [Description("Creates a timestamped message payload that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.")]
+    public partial class CreateTimestampedInitialPulseIntervalPayload : CreateInitialPulseIntervalPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the motor's maximum pulse interval, used as the first and last pulse interval of a rotation. The nominal pulse interval must be at least 100 us with initial intervals above 16383 us, 400 us above 131071 us and 1600 us above 524287 us, or the write is refused.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the InitialPulseInterval register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.InitialPulseInterval.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+    /// </summary>
+    [DisplayName("PulseStepIntervalPayload")]
+    [Description("Creates a message payload that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.")]
+    public partial class CreatePulseStepIntervalPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+        /// </summary>
+        [Description("The value that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.")]
+        public ushort PulseStepInterval { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulseStepInterval register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return PulseStepInterval;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulseStepInterval register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.PulseStepInterval.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+    /// </summary>
+    [DisplayName("TimestampedPulseStepIntervalPayload")]
+    [Description("Creates a timestamped message payload that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.")]
+    public partial class CreateTimestampedPulseStepIntervalPayload : CreatePulseStepIntervalPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulseStepInterval register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.PulseStepInterval.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the period of the pulse.
+    /// </summary>
+    [DisplayName("PulsePeriodPayload")]
+    [Description("Creates a message payload that sets the period of the pulse.")]
+    public partial class CreatePulsePeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the period of the pulse.
+        /// </summary>
+        [Description("The value that sets the period of the pulse.")]
+        public ushort PulsePeriod { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulsePeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return PulsePeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the period of the pulse.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulsePeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.PulsePeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the period of the pulse.
+    /// </summary>
+    [DisplayName("TimestampedPulsePeriodPayload")]
+    [Description("Creates a timestamped message payload that sets the period of the pulse.")]
+    public partial class CreateTimestampedPulsePeriodPayload : CreatePulsePeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the period of the pulse.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulsePeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.PulsePeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the reading of the quadrature encoder.
+    /// </summary>
+    [DisplayName("EncoderPayload")]
+    [Description("Creates a message payload that contains the reading of the quadrature encoder.")]
+    public partial class CreateEncoderPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the reading of the quadrature encoder.
+        /// </summary>
+        [Description("The value that contains the reading of the quadrature encoder.")]
+        public short Encoder { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Encoder register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return Encoder;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the reading of the quadrature encoder.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Encoder register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.Encoder.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the reading of the quadrature encoder.
+    /// </summary>
+    [DisplayName("TimestampedEncoderPayload")]
+    [Description("Creates a timestamped message payload that contains the reading of the quadrature encoder.")]
+    public partial class CreateTimestampedEncoderPayload : CreateEncoderPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the reading of the quadrature encoder.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Encoder register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.Encoder.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the reading of the analog input.
+    /// </summary>
+    [DisplayName("AnalogInputPayload")]
+    [Description("Creates a message payload that contains the reading of the analog input.")]
+    public partial class CreateAnalogInputPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the reading of the analog input.
+        /// </summary>
+        [Description("The value that contains the reading of the analog input.")]
+        public short AnalogInput { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogInput register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return AnalogInput;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the reading of the analog input.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogInput register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.AnalogInput.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the reading of the analog input.
+    /// </summary>
+    [DisplayName("TimestampedAnalogInputPayload")]
+    [Description("Creates a timestamped message payload that contains the reading of the analog input.")]
+    public partial class CreateTimestampedAnalogInputPayload : CreateAnalogInputPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the reading of the analog input.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogInput register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.AnalogInput.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the state of the stop switch.
+    /// </summary>
+    [DisplayName("StopSwitchPayload")]
+    [Description("Creates a message payload that contains the state of the stop switch.")]
+    public partial class CreateStopSwitchPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the state of the stop switch.
+        /// </summary>
+        [Description("The value that contains the state of the stop switch.")]
+        public StopSwitchFlags StopSwitch { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StopSwitch register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StopSwitchFlags GetPayload()
+        {
+            return StopSwitch;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the state of the stop switch.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StopSwitch register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.StopSwitch.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the state of the stop switch.
+    /// </summary>
+    [DisplayName("TimestampedStopSwitchPayload")]
+    [Description("Creates a timestamped message payload that contains the state of the stop switch.")]
+    public partial class CreateTimestampedStopSwitchPayload : CreateStopSwitchPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the state of the stop switch.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StopSwitch register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.StopSwitch.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.
+    /// </summary>
+    [DisplayName("MotorStatePayload")]
+    [Description("Creates a message payload that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.")]
+    public partial class CreateMotorStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.
+        /// </summary>
+        [Description("The value that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.")]
+        public MotorStateFlags MotorState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MotorState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MotorStateFlags GetPayload()
+        {
+            return MotorState;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MotorState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.MotorState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.
+    /// </summary>
+    [DisplayName("TimestampedMotorStatePayload")]
+    [Description("Creates a timestamped message payload that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.")]
+    public partial class CreateTimestampedMotorStatePayload : CreateMotorStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the state of the motor. A scheduled start sends an event timestamped with the time it happened.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MotorState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.MotorState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets immediately the motor pulse interval. The value's sign defines the direction.
+    /// </summary>
+    [DisplayName("ImmediatePulsesPayload")]
+    [Description("Creates a message payload that sets immediately the motor pulse interval. The value's sign defines the direction.")]
+    public partial class CreateImmediatePulsesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets immediately the motor pulse interval. The value's sign defines the direction.
+        /// </summary>
+        [Description("The value that sets immediately the motor pulse interval. The value's sign defines the direction.")]
+        public short ImmediatePulses { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ImmediatePulses register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return ImmediatePulses;
+        }
+
+        /// <summary>
+        /// Creates a message that sets immediately the motor pulse interval. The value's sign defines the direction.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ImmediatePulses register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.ImmediatePulses.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets immediately the motor pulse interval. The value's sign defines the direction.
+    /// </summary>
+    [DisplayName("TimestampedImmediatePulsesPayload")]
+    [Description("Creates a timestamped message payload that sets immediately the motor pulse interval. The value's sign defines the direction.")]
+    public partial class CreateTimestampedImmediatePulsesPayload : CreateImmediatePulsesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets immediately the motor pulse interval. The value's sign defines the direction.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ImmediatePulses register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.ImmediatePulses.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that selects the motion profile used to accelerate and decelerate the motor.
+    /// </summary>
+    [DisplayName("ProfileTypePayload")]
+    [Description("Creates a message payload that selects the motion profile used to accelerate and decelerate the motor.")]
+    public partial class CreateProfileTypePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that selects the motion profile used to accelerate and decelerate the motor.
+        /// </summary>
+        [Description("The value that selects the motion profile used to accelerate and decelerate the motor.")]
+        public MotionProfile ProfileType { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProfileType register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MotionProfile GetPayload()
+        {
+            return ProfileType;
+        }
+
+        /// <summary>
+        /// Creates a message that selects the motion profile used to accelerate and decelerate the motor.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProfileType register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.ProfileType.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that selects the motion profile used to accelerate and decelerate the motor.
+    /// </summary>
+    [DisplayName("TimestampedProfileTypePayload")]
+    [Description("Creates a timestamped message payload that selects the motion profile used to accelerate and decelerate the motor.")]
+    public partial class CreateTimestampedProfileTypePayload : CreateProfileTypePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that selects the motion profile used to accelerate and decelerate the motor.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProfileType register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.ProfileType.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.
+    /// </summary>
+    [DisplayName("AccelerationPayload")]
+    [Description("Creates a message payload that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.")]
+    public partial class CreateAccelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.
+        /// </summary>
+        [Description("The value that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.")]
+        public uint Acceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Acceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Acceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Acceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.Acceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.
+    /// </summary>
+    [DisplayName("TimestampedAccelerationPayload")]
+    [Description("Creates a timestamped message payload that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.")]
+    public partial class CreateTimestampedAccelerationPayload : CreateAccelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the acceleration of the S-curve and constant acceleration profiles, in steps per second squared.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Acceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.Acceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the maximum jerk of the S-curve profile, in steps per second cubed.
+    /// </summary>
+    [DisplayName("JerkPayload")]
+    [Description("Creates a message payload that sets the maximum jerk of the S-curve profile, in steps per second cubed.")]
+    public partial class CreateJerkPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the maximum jerk of the S-curve profile, in steps per second cubed.
+        /// </summary>
+        [Description("The value that sets the maximum jerk of the S-curve profile, in steps per second cubed.")]
+        public uint Jerk { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Jerk register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Jerk;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the maximum jerk of the S-curve profile, in steps per second cubed.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Jerk register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.Jerk.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the maximum jerk of the S-curve profile, in steps per second cubed.
+    /// </summary>
+    [DisplayName("TimestampedJerkPayload")]
+    [Description("Creates a timestamped message payload that sets the maximum jerk of the S-curve profile, in steps per second cubed.")]
+    public partial class CreateTimestampedJerkPayload : CreateJerkPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the maximum jerk of the S-curve profile, in steps per second cubed.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Jerk register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.Jerk.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.
+    /// </summary>
+    [DisplayName("SegmentsPayload")]
+    [Description("Creates a message payload that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.")]
+    public partial class CreateSegmentsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.
+        /// </summary>
+        [Description("The value that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.")]
+        public int[] Segments { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Segments register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int[] GetPayload()
+        {
+            return Segments;
+        }
+
+        /// <summary>
+        /// Creates a message that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Segments register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.Segments.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.
+    /// </summary>
+    [DisplayName("TimestampedSegmentsPayload")]
+    [Description("Creates a timestamped message payload that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.")]
+    public partial class CreateTimestampedSegmentsPayload : CreateSegmentsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enqueues up to four motion segments, each one a pair with the number of pulses and the pulse interval at nominal speed. Pairs with zero pulses are ignored.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Segments register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.Segments.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the number of free entries in the motion segments queue.
+    /// </summary>
+    [DisplayName("SegmentQueueSpacePayload")]
+    [Description("Creates a message payload that contains the number of free entries in the motion segments queue.")]
+    public partial class CreateSegmentQueueSpacePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the number of free entries in the motion segments queue.
+        /// </summary>
+        [Description("The value that contains the number of free entries in the motion segments queue.")]
+        public byte SegmentQueueSpace { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SegmentQueueSpace register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return SegmentQueueSpace;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the number of free entries in the motion segments queue.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SegmentQueueSpace register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.SegmentQueueSpace.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the number of free entries in the motion segments queue.
+    /// </summary>
+    [DisplayName("TimestampedSegmentQueueSpacePayload")]
+    [Description("Creates a timestamped message payload that contains the number of free entries in the motion segments queue.")]
+    public partial class CreateTimestampedSegmentQueueSpacePayload : CreateSegmentQueueSpacePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the number of free entries in the motion segments queue.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SegmentQueueSpace register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.SegmentQueueSpace.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.
+    /// </summary>
+    [DisplayName("PositionPayload")]
+    [Description("Creates a message payload that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.")]
+    public partial class CreatePositionPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.
+        /// </summary>
+        [Description("The value that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.")]
+        public int Position { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Position register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return Position;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Position register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.Position.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.
+    /// </summary>
+    [DisplayName("TimestampedPositionPayload")]
+    [Description("Creates a timestamped message payload that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.")]
+    public partial class CreateTimestampedPositionPayload : CreatePositionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the absolute position of the motor, in pulses. Writing to this register sets the current position while the motor is stopped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Position register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.Position.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that moves the motor to the absolute position written in this register, in pulses.
+    /// </summary>
+    [DisplayName("MoveToPayload")]
+    [Description("Creates a message payload that moves the motor to the absolute position written in this register, in pulses.")]
+    public partial class CreateMoveToPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that moves the motor to the absolute position written in this register, in pulses.
+        /// </summary>
+        [Description("The value that moves the motor to the absolute position written in this register, in pulses.")]
+        public int MoveTo { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MoveTo register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return MoveTo;
+        }
+
+        /// <summary>
+        /// Creates a message that moves the motor to the absolute position written in this register, in pulses.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MoveTo register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.MoveTo.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that moves the motor to the absolute position written in this register, in pulses.
+    /// </summary>
+    [DisplayName("TimestampedMoveToPayload")]
+    [Description("Creates a timestamped message payload that moves the motor to the absolute position written in this register, in pulses.")]
+    public partial class CreateTimestampedMoveToPayload : CreateMoveToPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that moves the motor to the absolute position written in this register, in pulses.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MoveTo register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.MoveTo.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.
+    /// </summary>
+    [DisplayName("VelocityPayload")]
+    [Description("Creates a message payload that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.")]
+    public partial class CreateVelocityPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.
+        /// </summary>
+        [Description("The value that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.")]
+        public short Velocity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Velocity register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return Velocity;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Velocity register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.Velocity.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.
+    /// </summary>
+    [DisplayName("TimestampedVelocityPayload")]
+    [Description("Creates a timestamped message payload that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.")]
+    public partial class CreateTimestampedVelocityPayload : CreateVelocityPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the target velocity of the motor, in pulses per second. The motor accelerates toward it using the value of the Acceleration register and stops when set to zero.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Velocity register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.Velocity.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the closed loop correction of the motor position using the quadrature encoder.
+    /// </summary>
+    [DisplayName("ClosedLoopPayload")]
+    [Description("Creates a message payload that enables the closed loop correction of the motor position using the quadrature encoder.")]
+    public partial class CreateClosedLoopPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the closed loop correction of the motor position using the quadrature encoder.
+        /// </summary>
+        [Description("The value that enables the closed loop correction of the motor position using the quadrature encoder.")]
+        public ClosedLoopFlags ClosedLoop { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ClosedLoop register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ClosedLoopFlags GetPayload()
+        {
+            return ClosedLoop;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the closed loop correction of the motor position using the quadrature encoder.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ClosedLoop register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.ClosedLoop.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the closed loop correction of the motor position using the quadrature encoder.
+    /// </summary>
+    [DisplayName("TimestampedClosedLoopPayload")]
+    [Description("Creates a timestamped message payload that enables the closed loop correction of the motor position using the quadrature encoder.")]
+    public partial class CreateTimestampedClosedLoopPayload : CreateClosedLoopPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the closed loop correction of the motor position using the quadrature encoder.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ClosedLoop register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.ClosedLoop.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.
+    /// </summary>
+    [DisplayName("StepsPerCountPayload")]
+    [Description("Creates a message payload that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.")]
+    public partial class CreateStepsPerCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.
+        /// </summary>
+        [Description("The value that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.")]
+        public short StepsPerCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StepsPerCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return StepsPerCount;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StepsPerCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.StepsPerCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.
+    /// </summary>
+    [DisplayName("TimestampedStepsPerCountPayload")]
+    [Description("Creates a timestamped message payload that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.")]
+    public partial class CreateTimestampedStepsPerCountPayload : CreateStepsPerCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the number of pulses per encoder count, with 8 fractional bits. The sign matches the encoder direction to the motor direction.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StepsPerCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.StepsPerCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.
+    /// </summary>
+    [DisplayName("ClosedLoopGainsPayload")]
+    [Description("Creates a message payload that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.")]
+    public partial class CreateClosedLoopGainsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.
+        /// </summary>
+        [Description("The value that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.")]
+        public ushort[] ClosedLoopGains { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ClosedLoopGains register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return ClosedLoopGains;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ClosedLoopGains register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.ClosedLoopGains.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.
+    /// </summary>
+    [DisplayName("TimestampedClosedLoopGainsPayload")]
+    [Description("Creates a timestamped message payload that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.")]
+    public partial class CreateTimestampedClosedLoopGainsPayload : CreateClosedLoopGainsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the proportional and integral gains of the closed loop correction, with 8 fractional bits.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ClosedLoopGains register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.ClosedLoopGains.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the number of pulses missed by the motor and not yet corrected by the closed loop.
+    /// </summary>
+    [DisplayName("PositionErrorPayload")]
+    [Description("Creates a message payload that contains the number of pulses missed by the motor and not yet corrected by the closed loop.")]
+    public partial class CreatePositionErrorPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the number of pulses missed by the motor and not yet corrected by the closed loop.
+        /// </summary>
+        [Description("The value that contains the number of pulses missed by the motor and not yet corrected by the closed loop.")]
+        public int PositionError { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PositionError register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return PositionError;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the number of pulses missed by the motor and not yet corrected by the closed loop.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PositionError register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.PositionError.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the number of pulses missed by the motor and not yet corrected by the closed loop.
+    /// </summary>
+    [DisplayName("TimestampedPositionErrorPayload")]
+    [Description("Creates a timestamped message payload that contains the number of pulses missed by the motor and not yet corrected by the closed loop.")]
+    public partial class CreateTimestampedPositionErrorPayload : CreatePositionErrorPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the number of pulses missed by the motor and not yet corrected by the closed loop.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PositionError register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.PositionError.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the number of samples of the velocity waveform and restarts its upload.
+    /// </summary>
+    [DisplayName("WaveformLengthPayload")]
+    [Description("Creates a message payload that sets the number of samples of the velocity waveform and restarts its upload.")]
+    public partial class CreateWaveformLengthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the number of samples of the velocity waveform and restarts its upload.
+        /// </summary>
+        [Description("The value that sets the number of samples of the velocity waveform and restarts its upload.")]
+        public ushort WaveformLength { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the WaveformLength register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return WaveformLength;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the number of samples of the velocity waveform and restarts its upload.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the WaveformLength register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.WaveformLength.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the number of samples of the velocity waveform and restarts its upload.
+    /// </summary>
+    [DisplayName("TimestampedWaveformLengthPayload")]
+    [Description("Creates a timestamped message payload that sets the number of samples of the velocity waveform and restarts its upload.")]
+    public partial class CreateTimestampedWaveformLengthPayload : CreateWaveformLengthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the number of samples of the velocity waveform and restarts its upload.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the WaveformLength register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.WaveformLength.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.
+    /// </summary>
+    [DisplayName("WaveformSamplesPayload")]
+    [Description("Creates a message payload that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.")]
+    public partial class CreateWaveformSamplesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.
+        /// </summary>
+        [Description("The value that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.")]
+        public short[] WaveformSamples { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the WaveformSamples register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short[] GetPayload()
+        {
+            return WaveformSamples;
+        }
+
+        /// <summary>
+        /// Creates a message that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the WaveformSamples register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.WaveformSamples.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.
+    /// </summary>
+    [DisplayName("TimestampedWaveformSamplesPayload")]
+    [Description("Creates a timestamped message payload that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.")]
+    public partial class CreateTimestampedWaveformSamplesPayload : CreateWaveformSamplesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that appends up to 32 velocity samples to the waveform, in pulses per second. Samples beyond the waveform length are ignored.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the WaveformSamples register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.WaveformSamples.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the interval between the waveform samples, in microseconds.
+    /// </summary>
+    [DisplayName("WaveformSampleIntervalPayload")]
+    [Description("Creates a message payload that sets the interval between the waveform samples, in microseconds.")]
+    public partial class CreateWaveformSampleIntervalPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the interval between the waveform samples, in microseconds.
+        /// </summary>
+        [Description("The value that sets the interval between the waveform samples, in microseconds.")]
+        public ushort WaveformSampleInterval { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the WaveformSampleInterval register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return WaveformSampleInterval;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the interval between the waveform samples, in microseconds.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the WaveformSampleInterval register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.WaveformSampleInterval.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the interval between the waveform samples, in microseconds.
+    /// </summary>
+    [DisplayName("TimestampedWaveformSampleIntervalPayload")]
+    [Description("Creates a timestamped message payload that sets the interval between the waveform samples, in microseconds.")]
+    public partial class CreateTimestampedWaveformSampleIntervalPayload : CreateWaveformSampleIntervalPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the interval between the waveform samples, in microseconds.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the WaveformSampleInterval register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.WaveformSampleInterval.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts and stops the waveform playback. An event is sent when the playback ends.
+    /// </summary>
+    [DisplayName("WaveformControlPayload")]
+    [Description("Creates a message payload that starts and stops the waveform playback. An event is sent when the playback ends.")]
+    public partial class CreateWaveformControlPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that starts and stops the waveform playback. An event is sent when the playback ends.
+        /// </summary>
+        [Description("The value that starts and stops the waveform playback. An event is sent when the playback ends.")]
+        public WaveformControlFlags WaveformControl { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the WaveformControl register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public WaveformControlFlags GetPayload()
+        {
+            return WaveformControl;
+        }
+
+        /// <summary>
+        /// Creates a message that starts and stops the waveform playback. An event is sent when the playback ends.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the WaveformControl register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.WaveformControl.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts and stops the waveform playback. An event is sent when the playback ends.
+    /// </summary>
+    [DisplayName("TimestampedWaveformControlPayload")]
+    [Description("Creates a timestamped message payload that starts and stops the waveform playback. An event is sent when the playback ends.")]
+    public partial class CreateTimestampedWaveformControlPayload : CreateWaveformControlPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts and stops the waveform playback. An event is sent when the playback ends.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the WaveformControl register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.WaveformControl.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the peak velocity of the sinusoidal oscillation, in pulses per second.
+    /// </summary>
+    [DisplayName("OscillationAmplitudePayload")]
+    [Description("Creates a message payload that sets the peak velocity of the sinusoidal oscillation, in pulses per second.")]
+    public partial class CreateOscillationAmplitudePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the peak velocity of the sinusoidal oscillation, in pulses per second.
+        /// </summary>
+        [Description("The value that sets the peak velocity of the sinusoidal oscillation, in pulses per second.")]
+        public ushort OscillationAmplitude { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OscillationAmplitude register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return OscillationAmplitude;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the peak velocity of the sinusoidal oscillation, in pulses per second.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OscillationAmplitude register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.OscillationAmplitude.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the peak velocity of the sinusoidal oscillation, in pulses per second.
+    /// </summary>
+    [DisplayName("TimestampedOscillationAmplitudePayload")]
+    [Description("Creates a timestamped message payload that sets the peak velocity of the sinusoidal oscillation, in pulses per second.")]
+    public partial class CreateTimestampedOscillationAmplitudePayload : CreateOscillationAmplitudePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the peak velocity of the sinusoidal oscillation, in pulses per second.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OscillationAmplitude register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.OscillationAmplitude.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the frequency of the sinusoidal oscillation, in millihertz.
+    /// </summary>
+    [DisplayName("OscillationFrequencyPayload")]
+    [Description("Creates a message payload that sets the frequency of the sinusoidal oscillation, in millihertz.")]
+    public partial class CreateOscillationFrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the frequency of the sinusoidal oscillation, in millihertz.
+        /// </summary>
+        [Description("The value that sets the frequency of the sinusoidal oscillation, in millihertz.")]
+        public ushort OscillationFrequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OscillationFrequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return OscillationFrequency;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the frequency of the sinusoidal oscillation, in millihertz.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OscillationFrequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.OscillationFrequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the frequency of the sinusoidal oscillation, in millihertz.
+    /// </summary>
+    [DisplayName("TimestampedOscillationFrequencyPayload")]
+    [Description("Creates a timestamped message payload that sets the frequency of the sinusoidal oscillation, in millihertz.")]
+    public partial class CreateTimestampedOscillationFrequencyPayload : CreateOscillationFrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the frequency of the sinusoidal oscillation, in millihertz.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OscillationFrequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.OscillationFrequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.
+    /// </summary>
+    [DisplayName("OscillationPhasePayload")]
+    [Description("Creates a message payload that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.")]
+    public partial class CreateOscillationPhasePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.
+        /// </summary>
+        [Description("The value that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.")]
+        public ushort OscillationPhase { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OscillationPhase register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return OscillationPhase;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OscillationPhase register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.OscillationPhase.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.
+    /// </summary>
+    [DisplayName("TimestampedOscillationPhasePayload")]
+    [Description("Creates a timestamped message payload that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.")]
+    public partial class CreateTimestampedOscillationPhasePayload : CreateOscillationPhasePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the initial phase of the sinusoidal oscillation, in 1/65536 of a cycle.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OscillationPhase register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.OscillationPhase.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.
+    /// </summary>
+    [DisplayName("OscillationCyclesPayload")]
+    [Description("Creates a message payload that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.")]
+    public partial class CreateOscillationCyclesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.
+        /// </summary>
+        [Description("The value that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.")]
+        public ushort OscillationCycles { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OscillationCycles register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return OscillationCycles;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OscillationCycles register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.OscillationCycles.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.
+    /// </summary>
+    [DisplayName("TimestampedOscillationCyclesPayload")]
+    [Description("Creates a timestamped message payload that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.")]
+    public partial class CreateTimestampedOscillationCyclesPayload : CreateOscillationCyclesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the number of cycles of the sinusoidal oscillation. Zero oscillates until stopped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OscillationCycles register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.OscillationCycles.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that selects how the pulses of the velocity, waveform and oscillation modes are generated.
+    /// </summary>
+    [DisplayName("StepGeneratorPayload")]
+    [Description("Creates a message payload that selects how the pulses of the velocity, waveform and oscillation modes are generated.")]
+    public partial class CreateStepGeneratorPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that selects how the pulses of the velocity, waveform and oscillation modes are generated.
+        /// </summary>
+        [Description("The value that selects how the pulses of the velocity, waveform and oscillation modes are generated.")]
+        public StepGeneratorType StepGenerator { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StepGenerator register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StepGeneratorType GetPayload()
+        {
+            return StepGenerator;
+        }
+
+        /// <summary>
+        /// Creates a message that selects how the pulses of the velocity, waveform and oscillation modes are generated.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StepGenerator register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.StepGenerator.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that selects how the pulses of the velocity, waveform and oscillation modes are generated.
+    /// </summary>
+    [DisplayName("TimestampedStepGeneratorPayload")]
+    [Description("Creates a timestamped message payload that selects how the pulses of the velocity, waveform and oscillation modes are generated.")]
+    public partial class CreateTimestampedStepGeneratorPayload : CreateStepGeneratorPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that selects how the pulses of the velocity, waveform and oscillation modes are generated.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StepGenerator register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.StepGenerator.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables counting the pulses of the cruise phase in hardware, without step interrupts.
+    /// </summary>
+    [DisplayName("HardwareCruisePayload")]
+    [Description("Creates a message payload that enables counting the pulses of the cruise phase in hardware, without step interrupts.")]
+    public partial class CreateHardwareCruisePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables counting the pulses of the cruise phase in hardware, without step interrupts.
+        /// </summary>
+        [Description("The value that enables counting the pulses of the cruise phase in hardware, without step interrupts.")]
+        public HardwareCruiseFlags HardwareCruise { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the HardwareCruise register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public HardwareCruiseFlags GetPayload()
+        {
+            return HardwareCruise;
+        }
+
+        /// <summary>
+        /// Creates a message that enables counting the pulses of the cruise phase in hardware, without step interrupts.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HardwareCruise register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.HardwareCruise.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables counting the pulses of the cruise phase in hardware, without step interrupts.
+    /// </summary>
+    [DisplayName("TimestampedHardwareCruisePayload")]
+    [Description("Creates a timestamped message payload that enables counting the pulses of the cruise phase in hardware, without step interrupts.")]
+    public partial class CreateTimestampedHardwareCruisePayload : CreateHardwareCruisePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables counting the pulses of the cruise phase in hardware, without step interrupts.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HardwareCruise register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.HardwareCruise.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.
+    /// </summary>
+    [DisplayName("IsrStatisticsPayload")]
+    [Description("Creates a message payload that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.")]
+    public partial class CreateIsrStatisticsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.
+        /// </summary>
+        [Description("The value that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.")]
+        public ushort[] IsrStatistics { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the IsrStatistics register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return IsrStatistics;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the IsrStatistics register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.IsrStatistics.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.
+    /// </summary>
+    [DisplayName("TimestampedIsrStatisticsPayload")]
+    [Description("Creates a timestamped message payload that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.")]
+    public partial class CreateTimestampedIsrStatisticsPayload : CreateIsrStatisticsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the min, mean and max execution time and the max latency, in CPU cycles, of the step, ADC, external control and stop switch interrupts, followed by the worst step period error. Writing resets them. Only measured in firmware built with ISR_INSTRUMENTATION.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the IsrStatistics register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.IsrStatistics.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the trace of the step periods of the ramped moves. Enabling clears the trace.
+    /// </summary>
+    [DisplayName("TraceControlPayload")]
+    [Description("Creates a message payload that enables the trace of the step periods of the ramped moves. Enabling clears the trace.")]
+    public partial class CreateTraceControlPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the trace of the step periods of the ramped moves. Enabling clears the trace.
+        /// </summary>
+        [Description("The value that enables the trace of the step periods of the ramped moves. Enabling clears the trace.")]
+        public TraceControlFlags TraceControl { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TraceControl register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TraceControlFlags GetPayload()
+        {
+            return TraceControl;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the trace of the step periods of the ramped moves. Enabling clears the trace.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TraceControl register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.TraceControl.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the trace of the step periods of the ramped moves. Enabling clears the trace.
+    /// </summary>
+    [DisplayName("TimestampedTraceControlPayload")]
+    [Description("Creates a timestamped message payload that enables the trace of the step periods of the ramped moves. Enabling clears the trace.")]
+    public partial class CreateTimestampedTraceControlPayload : CreateTraceControlPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the trace of the step periods of the ramped moves. Enabling clears the trace.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TraceControl register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.TraceControl.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the number of steps traced. Only the last 256 steps are kept.
+    /// </summary>
+    [DisplayName("TraceStepsPayload")]
+    [Description("Creates a message payload that contains the number of steps traced. Only the last 256 steps are kept.")]
+    public partial class CreateTraceStepsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the number of steps traced. Only the last 256 steps are kept.
+        /// </summary>
+        [Description("The value that contains the number of steps traced. Only the last 256 steps are kept.")]
+        public uint TraceSteps { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TraceSteps register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return TraceSteps;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the number of steps traced. Only the last 256 steps are kept.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TraceSteps register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.VestibularH2.PulseStepInterval.FromPayload(messageType, GetPayload());
+            return Harp.VestibularH2.TraceSteps.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+    /// that contains the number of steps traced. Only the last 256 steps are kept.
     /// </summary>
-    [DisplayName("TimestampedPulseStepIntervalPayload")]
-    [Description("Creates a timestamped message payload that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.")]
-    public partial class CreateTimestampedPulseStepIntervalPayload : CreatePulseStepIntervalPayload
+    [DisplayName("TimestampedTraceStepsPayload")]
+    [Description("Creates a timestamped message payload that contains the number of steps traced. Only the last 256 steps are kept.")]
+    public partial class CreateTimestampedTraceStepsPayload : CreateTraceStepsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the acceleration. The pulse's interval is decreased by this value when accelerating and increased when de-accelerating.
+        /// Creates a timestamped message that contains the number of steps traced. Only the last 256 steps are kept.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PulseStepInterval register.</returns>
+        /// <returns>A new timestamped message for the TraceSteps register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.VestibularH2.PulseStepInterval.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.VestibularH2.TraceSteps.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the period of the pulse.
+    /// that sets the first step read from TraceData, counted from the oldest step kept.
     /// </summary>
-    [DisplayName("PulsePeriodPayload")]
-    [Description("Creates a message payload that sets the period of the pulse.")]
-    public partial class CreatePulsePeriodPayload
+    [DisplayName("TraceIndexPayload")]
+    [Description("Creates a message payload that sets the first step read from TraceData, counted from the oldest step kept.")]
+    public partial class CreateTraceIndexPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the period of the pulse.
+        /// Gets or sets the value that sets the first step read from TraceData, counted from the oldest step kept.
         /// </summary>
-        [Description("The value that sets the period of the pulse.")]
-        public ushort PulsePeriod { get; set; }
+        [Description("The value that sets the first step read from TraceData, counted from the oldest step kept.")]
+        public ushort TraceIndex { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PulsePeriod register.
+        /// Creates a message payload for the TraceIndex register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return PulsePeriod;
+            return TraceIndex;
         }
 
         /// <summary>
-        /// Creates a message that sets the period of the pulse.
+        /// Creates a message that sets the first step read from TraceData, counted from the oldest step kept.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PulsePeriod register.</returns>
+        /// <returns>A new message for the TraceIndex register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.VestibularH2.PulsePeriod.FromPayload(messageType, GetPayload());
+            return Harp.VestibularH2.TraceIndex.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the period of the pulse.
+    /// that sets the first step read from TraceData, counted from the oldest step kept.
     /// </summary>
-    [DisplayName("TimestampedPulsePeriodPayload")]
-    [Description("Creates a timestamped message payload that sets the period of the pulse.")]
-    public partial class CreateTimestampedPulsePeriodPayload : CreatePulsePeriodPayload
+    [DisplayName("TimestampedTraceIndexPayload")]
+    [Description("Creates a timestamped message payload that sets the first step read from TraceData, counted from the oldest step kept.")]
+    public partial class CreateTimestampedTraceIndexPayload : CreateTraceIndexPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the period of the pulse.
+        /// Creates a timestamped message that sets the first step read from TraceData, counted from the oldest step kept.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PulsePeriod register.</returns>
+        /// <returns>A new timestamped message for the TraceIndex register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.VestibularH2.PulsePeriod.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.VestibularH2.TraceIndex.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that contains the reading of the quadrature encoder.
+    /// that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.
     /// </summary>
-    [DisplayName("EncoderPayload")]
-    [Description("Creates a message payload that contains the reading of the quadrature encoder.")]
-    public partial class CreateEncoderPayload
+    [DisplayName("TraceDataPayload")]
+    [Description("Creates a message payload that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.")]
+    public partial class CreateTraceDataPayload
     {
         /// <summary>
-        /// Gets or sets the value that contains the reading of the quadrature encoder.
+        /// Gets or sets the value that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.
         /// </summary>
-        [Description("The value that contains the reading of the quadrature encoder.")]
-        public short Encoder { get; set; }
+        [Description("The value that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.")]
+        public uint[] TraceData { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Encoder register.
+        /// Creates a message payload for the TraceData register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public uint[] GetPayload()
         {
-            return Encoder;
+            return TraceData;
         }
 
         /// <summary>
-        /// Creates a message that contains the reading of the quadrature encoder.
+        /// Creates a message that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Encoder register.</returns>
+        /// <returns>A new message for the TraceData register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.VestibularH2.Encoder.FromPayload(messageType, GetPayload());
+            return Harp.VestibularH2.TraceData.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that contains the reading of the quadrature encoder.
+    /// that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.
     /// </summary>
-    [DisplayName("TimestampedEncoderPayload")]
-    [Description("Creates a timestamped message payload that contains the reading of the quadrature encoder.")]
-    public partial class CreateTimestampedEncoderPayload : CreateEncoderPayload
+    [DisplayName("TimestampedTraceDataPayload")]
+    [Description("Creates a timestamped message payload that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.")]
+    public partial class CreateTimestampedTraceDataPayload : CreateTraceDataPayload
     {
         /// <summary>
-        /// Creates a timestamped message that contains the reading of the quadrature encoder.
+        /// Creates a timestamped message that contains 16 traced steps starting at TraceIndex, which then advances. Bits 0-15 are the period in timer ticks, bits 16-18 the timer prescaler and bit 24 is set when decelerating.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Encoder register.</returns>
+        /// <returns>A new timestamped message for the TraceData register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.VestibularH2.Encoder.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.VestibularH2.TraceData.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that contains the reading of the analog input.
+    /// that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.
     /// </summary>
-    [DisplayName("AnalogInputPayload")]
-    [Description("Creates a message payload that contains the reading of the analog input.")]
-    public partial class CreateAnalogInputPayload
+    [DisplayName("ScheduledStartPayload")]
+    [Description("Creates a message payload that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.")]
+    public partial class CreateScheduledStartPayload
     {
         /// <summary>
-        /// Gets or sets the value that contains the reading of the analog input.
+        /// Gets or sets the value that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.
         /// </summary>
-        [Description("The value that contains the reading of the analog input.")]
-        public short AnalogInput { get; set; }
+        [Description("The value that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.")]
+        public uint[] ScheduledStart { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the AnalogInput register.
+        /// Creates a message payload for the ScheduledStart register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public uint[] GetPayload()
         {
-            return AnalogInput;
+            return ScheduledStart;
         }
 
         /// <summary>
-        /// Creates a message that contains the reading of the analog input.
+        /// Creates a message that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the AnalogInput register.</returns>
+        /// <returns>A new message for the ScheduledStart register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.VestibularH2.AnalogInput.FromPayload(messageType, GetPayload());
+            return Harp.VestibularH2.ScheduledStart.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that contains the reading of the analog input.
+    /// that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.
     /// </summary>
-    [DisplayName("TimestampedAnalogInputPayload")]
-    [Description("Creates a timestamped message payload that contains the reading of the analog input.")]
-    public partial class CreateTimestampedAnalogInputPayload : CreateAnalogInputPayload
+    [DisplayName("TimestampedScheduledStartPayload")]
+    [Description("Creates a timestamped message payload that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.")]
+    public partial class CreateTimestampedScheduledStartPayload : CreateScheduledStartPayload
     {
         /// <summary>
-        /// Creates a timestamped message that contains the reading of the analog input.
+        /// Creates a timestamped message that starts the next move or waveform at the Harp timestamp [seconds, microseconds], at least 1 ms in the future. Writing zeros cancels it.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the AnalogInput register.</returns>
+        /// <returns>A new timestamped message for the ScheduledStart register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.VestibularH2.AnalogInput.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.VestibularH2.ScheduledStart.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that contains the state of the stop switch.
+    /// that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.
     /// </summary>
-    [DisplayName("StopSwitchPayload")]
-    [Description("Creates a message payload that contains the state of the stop switch.")]
-    public partial class CreateStopSwitchPayload
+    [DisplayName("MotionCommandPayload")]
+    [Description("Creates a message payload that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.")]
+    public partial class CreateMotionCommandPayload
     {
         /// <summary>
-        /// Gets or sets the value that contains the state of the stop switch.
+        /// Gets or sets the value that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.
         /// </summary>
-        [Description("The value that contains the state of the stop switch.")]
-        public StopSwitchFlags StopSwitch { get; set; }
+        [Description("The value that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.")]
+        public int[] MotionCommand { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the StopSwitch register.
+        /// Creates a message payload for the MotionCommand register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public StopSwitchFlags GetPayload()
+        public int[] GetPayload()
         {
-            return StopSwitch;
+            return MotionCommand;
         }
 
         /// <summary>
-        /// Creates a message that contains the state of the stop switch.
+        /// Creates a message that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the StopSwitch register.</returns>
+        /// <returns>A new message for the MotionCommand register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.VestibularH2.StopSwitch.FromPayload(messageType, GetPayload());
+            return Harp.VestibularH2.MotionCommand.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that contains the state of the stop switch.
+    /// that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.
     /// </summary>
-    [DisplayName("TimestampedStopSwitchPayload")]
-    [Description("Creates a timestamped message payload that contains the state of the stop switch.")]
-    public partial class CreateTimestampedStopSwitchPayload : CreateStopSwitchPayload
+    [DisplayName("TimestampedMotionCommandPayload")]
+    [Description("Creates a timestamped message payload that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.")]
+    public partial class CreateTimestampedMotionCommandPayload : CreateMotionCommandPayload
     {
         /// <summary>
-        /// Creates a timestamped message that contains the state of the stop switch.
+        /// Creates a timestamped message that sets all the motion parameters at once and moves the motor, as [steps, nominal pulse interval, initial pulse interval, pulse step interval, pulse period, profile type, acceleration, jerk]. Zero steps only sets the parameters. During a ramped move the new ramp and the steps, added to the move, apply from the next pulse.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the StopSwitch register.</returns>
+        /// <returns>A new timestamped message for the MotionCommand register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.VestibularH2.StopSwitch.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.VestibularH2.MotionCommand.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that contains the state of the motor.
+    /// that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.
     /// </summary>
-    [DisplayName("MotorStatePayload")]
-    [Description("Creates a message payload that contains the state of the motor.")]
-    public partial class CreateMotorStatePayload
+    [DisplayName("ExternalControlPayload")]
+    [Description("Creates a message payload that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.")]
+    public partial class CreateExternalControlPayload
     {
         /// <summary>
-        /// Gets or sets the value that contains the state of the motor.
+        /// Gets or sets the value that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.
         /// </summary>
-        [Description("The value that contains the state of the motor.")]
-        public MotorStateFlags MotorState { get; set; }
+        [Description("The value that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.")]
+        public ExternalControlProtocol ExternalControl { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MotorState register.
+        /// Creates a message payload for the ExternalControl register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public MotorStateFlags GetPayload()
+        public ExternalControlProtocol GetPayload()
         {
-            return MotorState;
+            return ExternalControl;
         }
 
         /// <summary>
-        /// Creates a message that contains the state of the motor.
+        /// Creates a message that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MotorState register.</returns>
+        /// <returns>A new message for the ExternalControl register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.VestibularH2.MotorState.FromPayload(messageType, GetPayload());
+            return Harp.VestibularH2.ExternalControl.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that contains the state of the motor.
+    /// that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.
     /// </summary>
-    [DisplayName("TimestampedMotorStatePayload")]
-    [Description("Creates a timestamped message payload that contains the state of the motor.")]
-    public partial class CreateTimestampedMotorStatePayload : CreateMotorStatePayload
+    [DisplayName("TimestampedExternalControlPayload")]
+    [Description("Creates a timestamped message payload that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.")]
+    public partial class CreateTimestampedExternalControlPayload : CreateExternalControlPayload
     {
         /// <summary>
-        /// Creates a timestamped message that contains the state of the motor.
+        /// Creates a timestamped message that selects the protocol of the external motor control on the serial input. The framed protocol takes 9 byte frames [0xA5, sequence, command, value (S32), CRC-16] with commands 1 period, 2 velocity and 3 acceleration.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MotorState register.</returns>
+        /// <returns>A new timestamped message for the ExternalControl register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.VestibularH2.MotorState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.VestibularH2.ExternalControl.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets immediately the motor pulse interval. The value's sign defines the direction.
+    /// that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.
     /// </summary>
-    [DisplayName("ImmediatePulsesPayload")]
-    [Description("Creates a message payload that sets immediately the motor pulse interval. The value's sign defines the direction.")]
-    public partial class CreateImmediatePulsesPayload
+    [DisplayName("ExternalBaudRatePayload")]
+    [Description("Creates a message payload that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.")]
+    public partial class CreateExternalBaudRatePayload
     {
         /// <summary>
-        /// Gets or sets the value that sets immediately the motor pulse interval. The value's sign defines the direction.
+        /// Gets or sets the value that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.
         /// </summary>
-        [Description("The value that sets immediately the motor pulse interval. The value's sign defines the direction.")]
-        public short ImmediatePulses { get; set; }
+        [Description("The value that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.")]
+        public uint ExternalBaudRate { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ImmediatePulses register.
+        /// Creates a message payload for the ExternalBaudRate register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public uint GetPayload()
         {
-            return ImmediatePulses;
+            return ExternalBaudRate;
         }
 
         /// <summary>
-        /// Creates a message that sets immediately the motor pulse interval. The value's sign defines the direction.
+        /// Creates a message that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ImmediatePulses register.</returns>
+        /// <returns>A new message for the ExternalBaudRate register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.VestibularH2.ImmediatePulses.FromPayload(messageType, GetPayload());
+            return Harp.VestibularH2.ExternalBaudRate.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets immediately the motor pulse interval. The value's sign defines the direction.
+    /// that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.
     /// </summary>
-    [DisplayName("TimestampedImmediatePulsesPayload")]
-    [Description("Creates a timestamped message payload that sets immediately the motor pulse interval. The value's sign defines the direction.")]
-    public partial class CreateTimestampedImmediatePulsesPayload : CreateImmediatePulsesPayload
+    [DisplayName("TimestampedExternalBaudRatePayload")]
+    [Description("Creates a timestamped message payload that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.")]
+    public partial class CreateTimestampedExternalBaudRatePayload : CreateExternalBaudRatePayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets immediately the motor pulse interval. The value's sign defines the direction.
+        /// Creates a timestamped message that sets the baud rate of the external motor control, in bits per second. Only baud rates within 2% of 4 MHz divided by an integer are accepted.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ImmediatePulses register.</returns>
+        /// <returns>A new timestamped message for the ExternalBaudRate register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.VestibularH2.ImmediatePulses.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.VestibularH2.ExternalBaudRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.
+    /// </summary>
+    [DisplayName("ExternalStatisticsPayload")]
+    [Description("Creates a message payload that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.")]
+    public partial class CreateExternalStatisticsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.
+        /// </summary>
+        [Description("The value that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.")]
+        public ushort[] ExternalStatistics { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ExternalStatistics register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return ExternalStatistics;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ExternalStatistics register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.ExternalStatistics.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.
+    /// </summary>
+    [DisplayName("TimestampedExternalStatisticsPayload")]
+    [Description("Creates a timestamped message payload that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.")]
+    public partial class CreateTimestampedExternalStatisticsPayload : CreateExternalStatisticsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the frames received, CRC errors, lost frames, rejected commands and receive ring overruns of the framed external control. Writing resets them.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ExternalStatistics register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.ExternalStatistics.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.
+    /// </summary>
+    [DisplayName("EncoderVelocityPayload")]
+    [Description("Creates a message payload that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.")]
+    public partial class CreateEncoderVelocityPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.
+        /// </summary>
+        [Description("The value that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.")]
+        public int EncoderVelocity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EncoderVelocity register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return EncoderVelocity;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EncoderVelocity register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.VestibularH2.EncoderVelocity.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.
+    /// </summary>
+    [DisplayName("TimestampedEncoderVelocityPayload")]
+    [Description("Creates a timestamped message payload that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.")]
+    public partial class CreateTimestampedEncoderVelocityPayload : CreateEncoderVelocityPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the velocity of the quadrature encoder, in counts per second with 8 fractional bits. At low speed it is timed from the encoder edges instead of the count difference, with the 32 us Harp timestamp over at least 4 ms. Sent with the Encoder events.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EncoderVelocity register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.VestibularH2.EncoderVelocity.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
@@ -1945,4 +7265,75 @@ namespace Harp.VestibularH2
         None = 0x0,
         IsMoving = 0x1
     }
+
+    /// <summary>
+    /// Flags to configure the closed loop correction of the motor position.
+    /// </summary>
+    [Flags]
+    public enum ClosedLoopFlags : byte
+    {
+        None = 0x0,
+        EnableClosedLoop = 0x1
+    }
+
+    /// <summary>
+    /// Flags to control the playback of the velocity waveform.
+    /// </summary>
+    [Flags]
+    public enum WaveformControlFlags : byte
+    {
+        None = 0x0,
+        Start = 0x1,
+        Stop = 0x2,
+        Loop = 0x4,
+        StartOscillation = 0x8
+    }
+
+    /// <summary>
+    /// Flags to configure the hardware counting of the cruise phase.
+    /// </summary>
+    [Flags]
+    public enum HardwareCruiseFlags : byte
+    {
+        None = 0x0,
+        EnableHardwareCruise = 0x1
+    }
+
+    /// <summary>
+    /// Flags to configure the trace of the step periods.
+    /// </summary>
+    [Flags]
+    public enum TraceControlFlags : byte
+    {
+        None = 0x0,
+        EnableTrace = 0x1
+    }
+
+    /// <summary>
+    /// Available motion profiles.
+    /// </summary>
+    public enum MotionProfile : byte
+    {
+        Linear = 0,
+        SCurve = 1,
+        ConstantAcceleration = 2
+    }
+
+    /// <summary>
+    /// Available pulse generation engines.
+    /// </summary>
+    public enum StepGeneratorType : byte
+    {
+        Period = 0,
+        Dds = 1
+    }
+
+    /// <summary>
+    /// Available protocols of the external motor control.
+    /// </summary>
+    public enum ExternalControlProtocol : byte
+    {
+        Legacy = 0,
+        Framed = 1
+    }
 }